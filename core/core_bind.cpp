@@ -169,6 +169,25 @@ Error ResourceSaver::save(const Ref<Resource> &p_resource, const String &p_path,
 	return ::ResourceSaver::save(p_resource, p_path, p_flags);
 }
 
+Error ResourceSaver::save_threaded(const Ref<Resource> &p_resource, const String &p_path, BitField<SaverFlags> p_flags) {
+	return ::ResourceSaver::save_threaded(p_resource, p_path, p_flags);
+}
+
+ResourceSaver::ThreadSaveStatus ResourceSaver::save_threaded_get_status(const String &p_path, Array r_progress) {
+	float progress = 0;
+	::ResourceSaver::ThreadSaveStatus tss = ::ResourceSaver::save_threaded_get_status(p_path, &progress);
+	// Default array should never be modified, it causes the hash of the method to change.
+	if (!ClassDB::is_default_array_arg(r_progress)) {
+		r_progress.resize(1);
+		r_progress[0] = progress;
+	}
+	return (ThreadSaveStatus)tss;
+}
+
+Error ResourceSaver::save_threaded_wait(const String &p_path) {
+	return ::ResourceSaver::save_threaded_wait(p_path);
+}
+
 Error ResourceSaver::set_uid(const String &p_path, ResourceUID::ID p_uid) {
 	return ::ResourceSaver::set_uid(p_path, p_uid);
 }
@@ -197,6 +216,9 @@ ResourceUID::ID ResourceSaver::get_resource_id_for_path(const String &p_path, bo
 
 void ResourceSaver::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("save", "resource", "path", "flags"), &ResourceSaver::save, DEFVAL(""), DEFVAL((uint32_t)FLAG_NONE));
+	ClassDB::bind_method(D_METHOD("save_threaded", "resource", "path", "flags"), &ResourceSaver::save_threaded, DEFVAL(""), DEFVAL((uint32_t)FLAG_NONE));
+	ClassDB::bind_method(D_METHOD("save_threaded_get_status", "path", "progress"), &ResourceSaver::save_threaded_get_status, DEFVAL_ARRAY);
+	ClassDB::bind_method(D_METHOD("save_threaded_wait", "path"), &ResourceSaver::save_threaded_wait);
 	ClassDB::bind_method(D_METHOD("set_uid", "resource", "uid"), &ResourceSaver::set_uid);
 	ClassDB::bind_method(D_METHOD("get_recognized_extensions", "type"), &ResourceSaver::get_recognized_extensions);
 	ClassDB::bind_method(D_METHOD("add_resource_format_saver", "format_saver", "at_front"), &ResourceSaver::add_resource_format_saver, DEFVAL(false));
@@ -211,6 +233,11 @@ void ResourceSaver::_bind_methods() {
 	BIND_BITFIELD_FLAG(FLAG_SAVE_BIG_ENDIAN);
 	BIND_BITFIELD_FLAG(FLAG_COMPRESS);
 	BIND_BITFIELD_FLAG(FLAG_REPLACE_SUBRESOURCE_PATHS);
+
+	BIND_ENUM_CONSTANT(THREAD_SAVE_INVALID_RESOURCE);
+	BIND_ENUM_CONSTANT(THREAD_SAVE_IN_PROGRESS);
+	BIND_ENUM_CONSTANT(THREAD_SAVE_FAILED);
+	BIND_ENUM_CONSTANT(THREAD_SAVE_SAVED);
 }
 
 ////// Logger ///////
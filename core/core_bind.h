@@ -109,9 +109,19 @@ public:
 		FLAG_REPLACE_SUBRESOURCE_PATHS = 64,
 	};
 
+	enum ThreadSaveStatus {
+		THREAD_SAVE_INVALID_RESOURCE,
+		THREAD_SAVE_IN_PROGRESS,
+		THREAD_SAVE_FAILED,
+		THREAD_SAVE_SAVED
+	};
+
 	static ResourceSaver *get_singleton() { return singleton; }
 
 	Error save(const Ref<Resource> &p_resource, const String &p_path, BitField<SaverFlags> p_flags);
+	Error save_threaded(const Ref<Resource> &p_resource, const String &p_path, BitField<SaverFlags> p_flags);
+	ThreadSaveStatus save_threaded_get_status(const String &p_path, Array r_progress = ClassDB::default_array_arg);
+	Error save_threaded_wait(const String &p_path);
 	Error set_uid(const String &p_path, ResourceUID::ID p_uid);
 	Vector<String> get_recognized_extensions(const Ref<Resource> &p_resource);
 	void add_resource_format_saver(Ref<ResourceFormatSaver> p_format_saver, bool p_at_front);
@@ -704,6 +714,7 @@ VARIANT_ENUM_CAST(CoreBind::ResourceLoader::ThreadLoadStatus);
 VARIANT_ENUM_CAST(CoreBind::ResourceLoader::CacheMode);
 
 VARIANT_BITFIELD_CAST(CoreBind::ResourceSaver::SaverFlags);
+VARIANT_ENUM_CAST(CoreBind::ResourceSaver::ThreadSaveStatus);
 
 VARIANT_ENUM_CAST(CoreBind::OS::RenderingDriver);
 VARIANT_ENUM_CAST(CoreBind::OS::SystemDir);
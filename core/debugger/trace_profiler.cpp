@@ -0,0 +1,169 @@
+/**************************************************************************/
+/*  trace_profiler.cpp                                                    */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             REDOT ENGINE                               */
+/*                        https://redotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2024-present Redot Engine contributors                   */
+/*                                          (see REDOT_AUTHORS.md)        */
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include "trace_profiler.h"
+
+#ifdef TRACE_PROFILER_ENABLED
+
+#include "core/config/project_settings.h"
+#include "core/io/file_access.h"
+#include "core/os/mutex.h"
+#include "core/os/os.h"
+#include "core/os/thread.h"
+#include "core/templates/local_vector.h"
+
+namespace {
+
+struct Event {
+	const char *name = nullptr;
+	StringName detail;
+	uint64_t begin = 0;
+	uint64_t end = 0;
+};
+
+// Only the latest events of every thread are kept, older ones get overwritten.
+static constexpr uint64_t THREAD_BUFFER_SIZE = 1 << 16;
+
+struct ThreadBuffer {
+	uint32_t index = 0;
+	bool main_thread = false;
+	Event *events = nullptr;
+	uint64_t count = 0; // Events written since the start, wrapping around the buffer.
+};
+
+Mutex buffers_mutex;
+LocalVector<ThreadBuffer *> buffers;
+String trace_path;
+// Increased whenever the buffers are freed, so threads know their cached buffer is gone without reading it.
+SafeNumeric<uint32_t> buffers_generation;
+thread_local ThreadBuffer *thread_buffer = nullptr;
+thread_local uint32_t thread_buffer_generation = 0;
+
+} // namespace
+
+uint64_t TraceProfiler::_get_ticks_usec() {
+	return OS::get_singleton()->get_ticks_usec();
+}
+
+void TraceProfiler::_record(const char *p_name, const StringName &p_detail, uint64_t p_begin) {
+	uint64_t end = _get_ticks_usec();
+
+	if (unlikely(!active.is_set())) {
+		// Recording stopped while the zone was open, the buffers may be gone already.
+		return;
+	}
+
+	const uint32_t generation = buffers_generation.get();
+	if (unlikely(thread_buffer_generation != generation)) {
+		thread_buffer = nullptr;
+	}
+
+	if (unlikely(!thread_buffer)) {
+		ThreadBuffer *buffer = memnew(ThreadBuffer);
+		buffer->main_thread = Thread::is_main_thread();
+		buffer->events = memnew_arr(Event, THREAD_BUFFER_SIZE);
+
+		MutexLock lock(buffers_mutex);
+		buffer->index = buffers.size();
+		buffers.push_back(buffer);
+		thread_buffer = buffer;
+		thread_buffer_generation = generation;
+	}
+
+	Event &event = thread_buffer->events[thread_buffer->count & (THREAD_BUFFER_SIZE - 1)];
+	event.name = p_name;
+	event.detail = p_detail;
+	event.begin = p_begin;
+	event.end = end;
+	thread_buffer->count++;
+}
+
+void TraceProfiler::start(const String &p_path) {
+	trace_path = p_path;
+	active.set();
+}
+
+void TraceProfiler::stop() {
+	if (!active.is_set()) {
+		return;
+	}
+	active.clear();
+
+	// Resolved now, the project settings are gone by the time the trace is written.
+	if (ProjectSettings::get_singleton()) {
+		trace_path = ProjectSettings::get_singleton()->globalize_path(trace_path);
+	}
+}
+
+void TraceProfiler::finish() {
+	stop();
+
+	MutexLock lock(buffers_mutex);
+
+	if (trace_path.is_empty()) {
+		return;
+	}
+
+	Ref<FileAccess> f = FileAccess::open(trace_path, FileAccess::WRITE);
+	if (f.is_null()) {
+		ERR_PRINT(vformat("Can't open the trace file at \"%s\".", trace_path));
+	} else {
+		f->store_string("{\"traceEvents\":[\n");
+		bool first = true;
+		for (const ThreadBuffer *buffer : buffers) {
+			String thread_name = buffer->main_thread ? String("Main Thread") : vformat("Thread %d", buffer->index);
+			f->store_string(vformat("%s{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,\"tid\":%d,\"args\":{\"name\":\"%s\"}}", first ? "" : ",\n", buffer->index, thread_name));
+			first = false;
+
+			uint64_t from = buffer->count > THREAD_BUFFER_SIZE ? buffer->count - THREAD_BUFFER_SIZE : 0;
+			for (uint64_t i = from; i < buffer->count; i++) {
+				const Event &event = buffer->events[i & (THREAD_BUFFER_SIZE - 1)];
+				String name = event.detail.is_empty() ? String(event.name) : String(event.detail);
+				f->store_string(vformat(",\n{\"name\":\"%s\",\"cat\":\"%s\",\"ph\":\"X\",\"pid\":0,\"tid\":%d,\"ts\":%d,\"dur\":%d}", name.json_escape(), String(event.name).json_escape(), buffer->index, event.begin, event.end - event.begin));
+			}
+		}
+		f->store_string("\n]}\n");
+		print_line(vformat("Profiling trace written to \"%s\".", trace_path));
+	}
+
+	// Other threads are gone by now, free all buffers at once. The StringNames need to be released before they are cleaned up.
+	for (ThreadBuffer *buffer : buffers) {
+		memdelete_arr(buffer->events);
+		memdelete(buffer);
+	}
+	buffers.clear();
+	buffers_generation.increment();
+	thread_buffer = nullptr;
+	trace_path = String();
+}
+
+#endif // TRACE_PROFILER_ENABLED
@@ -0,0 +1,101 @@
+/**************************************************************************/
+/*  trace_profiler.h                                                      */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             REDOT ENGINE                               */
+/*                        https://redotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2024-present Redot Engine contributors                   */
+/*                                          (see REDOT_AUTHORS.md)        */
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+
+// Scoped-zone CPU profiler, recording when zones begin and end into per-thread ring buffers.
+// Enabled with the `trace_profiler=yes` build option; the recording itself is started with `--profile-trace <file>`,
+// and the zones are written to that file in the Chrome trace event format when the engine quits.
+// When the build option is disabled, the TRACE_ZONE macros compile to nothing.
+
+#ifdef TRACE_PROFILER_ENABLED
+
+#include "core/string/string_name.h"
+#include "core/templates/safe_refcount.h"
+
+class TraceProfiler {
+public:
+	class Zone {
+		const char *name = nullptr; // Not recording if null.
+		StringName detail;
+		uint64_t begin = 0;
+
+	public:
+		_FORCE_INLINE_ Zone(const char *p_name) {
+			if (unlikely(active.is_set())) {
+				name = p_name;
+				begin = _get_ticks_usec();
+			}
+		}
+		_FORCE_INLINE_ Zone(const char *p_name, const StringName &p_detail) {
+			if (unlikely(active.is_set())) {
+				name = p_name;
+				detail = p_detail;
+				begin = _get_ticks_usec();
+			}
+		}
+		_FORCE_INLINE_ ~Zone() {
+			if (unlikely(name)) {
+				_record(name, detail, begin);
+			}
+		}
+	};
+
+private:
+	static inline SafeFlag active;
+
+	static uint64_t _get_ticks_usec();
+	static void _record(const char *p_name, const StringName &p_detail, uint64_t p_begin);
+
+public:
+	static void start(const String &p_path);
+	// Stops recording. Zones still open on other threads are dropped when they end.
+	static void stop();
+	// Writes the trace and frees the buffers. Must only be called once no other thread can record anymore.
+	static void finish();
+	_FORCE_INLINE_ static bool is_active() { return active.is_set(); }
+};
+
+#define _TRACE_ZONE_VARIABLE_IMPL(m_line) _trace_zone_##m_line
+#define _TRACE_ZONE_VARIABLE(m_line) _TRACE_ZONE_VARIABLE_IMPL(m_line)
+
+// Records the time spent until the end of the current scope. The name must be a string literal.
+#define TRACE_ZONE(m_name) TraceProfiler::Zone _TRACE_ZONE_VARIABLE(__LINE__)(m_name)
+// Same, also recording a StringName to tell apart zones sharing the same name (e.g. the function being called).
+#define TRACE_ZONE_DETAIL(m_name, m_detail) TraceProfiler::Zone _TRACE_ZONE_VARIABLE(__LINE__)(m_name, m_detail)
+
+#else
+
+#define TRACE_ZONE(m_name)
+#define TRACE_ZONE_DETAIL(m_name, m_detail)
+
+#endif // TRACE_PROFILER_ENABLED
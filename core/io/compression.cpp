@@ -43,11 +43,19 @@
 #include <brotli/decode.h>
 #endif
 
-// Caches for zstd.
-static BinaryMutex mutex;
-static ZSTD_DCtx *current_zstd_d_ctx = nullptr;
-static bool current_zstd_long_distance_matching;
-static int current_zstd_window_log_size;
+// Cache for zstd, one per thread so blocks can be decompressed in parallel.
+struct ZstdDecompressionContext {
+	ZSTD_DCtx *ctx = nullptr;
+	bool long_distance_matching = false;
+	int window_log_size = 0;
+
+	~ZstdDecompressionContext() {
+		if (ctx) {
+			ZSTD_freeDCtx(ctx);
+		}
+	}
+};
+static thread_local ZstdDecompressionContext current_zstd_d_ctx;
 
 int Compression::compress(uint8_t *p_dst, const uint8_t *p_src, int p_src_size, Mode p_mode) {
 	switch (p_mode) {
@@ -194,22 +202,21 @@ int Compression::decompress(uint8_t *p_dst, int p_dst_max_size, const uint8_t *p
 			return total;
 		} break;
 		case MODE_ZSTD: {
-			MutexLock lock(mutex);
-
-			if (!current_zstd_d_ctx || current_zstd_long_distance_matching != zstd_long_distance_matching || current_zstd_window_log_size != zstd_window_log_size) {
-				if (current_zstd_d_ctx) {
-					ZSTD_freeDCtx(current_zstd_d_ctx);
+			ZstdDecompressionContext &dctx = current_zstd_d_ctx;
+			if (!dctx.ctx || dctx.long_distance_matching != zstd_long_distance_matching || dctx.window_log_size != zstd_window_log_size) {
+				if (dctx.ctx) {
+					ZSTD_freeDCtx(dctx.ctx);
 				}
 
-				current_zstd_d_ctx = ZSTD_createDCtx();
+				dctx.ctx = ZSTD_createDCtx();
 				if (zstd_long_distance_matching) {
-					ZSTD_DCtx_setParameter(current_zstd_d_ctx, ZSTD_d_windowLogMax, zstd_window_log_size);
+					ZSTD_DCtx_setParameter(dctx.ctx, ZSTD_d_windowLogMax, zstd_window_log_size);
 				}
-				current_zstd_long_distance_matching = zstd_long_distance_matching;
-				current_zstd_window_log_size = zstd_window_log_size;
+				dctx.long_distance_matching = zstd_long_distance_matching;
+				dctx.window_log_size = zstd_window_log_size;
 			}
 
-			int ret = ZSTD_decompressDCtx(current_zstd_d_ctx, p_dst, p_dst_max_size, p_src, p_src_size);
+			int ret = ZSTD_decompressDCtx(dctx.ctx, p_dst, p_dst_max_size, p_src, p_src_size);
 			return ret;
 		} break;
 	}
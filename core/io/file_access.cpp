@@ -184,6 +184,26 @@ Ref<FileAccess> FileAccess::open(const String &p_path, int p_mode_flags, Error *
 	return ret;
 }
 
+Ref<FileAccess> FileAccess::open_mapped(const String &p_path, Error *r_error) {
+	Ref<FileAccess> ret;
+	Error err = ERR_UNAVAILABLE;
+	if (create_mapped_func && !p_path.begins_with("pipe://")) {
+		ret = create_mapped_func();
+		// Resolves the path like a regular file of the same kind.
+		ret->_set_access_type(create_for_path(p_path)->get_access_type());
+		err = ret->open_internal(p_path, READ);
+	}
+
+	if (r_error) {
+		*r_error = err;
+	}
+	if (err != OK) {
+		ret.unref();
+	}
+
+	return ret;
+}
+
 Ref<FileAccess> FileAccess::_open(const String &p_path, ModeFlags p_mode_flags) {
 	Error err = OK;
 	Ref<FileAccess> fa = open(p_path, p_mode_flags, &err);
@@ -567,6 +587,19 @@ Vector<uint8_t> FileAccess::get_buffer(int64_t p_length) const {
 	return data;
 }
 
+Vector<uint8_t> FileAccess::get_buffer_view(int64_t p_length) {
+	ERR_FAIL_COND_V_MSG(p_length < 0, Vector<uint8_t>(), "Length of buffer cannot be smaller than 0.");
+
+	const uint64_t position = get_position();
+	Vector<uint8_t> view = get_mapped_view(position, p_length);
+	if (view.size() == p_length) {
+		seek(position + p_length);
+		return view;
+	}
+
+	return get_buffer(p_length);
+}
+
 String FileAccess::get_as_utf8_string(bool p_skip_cr) const {
 	Vector<uint8_t> sourcef;
 	uint64_t len = get_length();
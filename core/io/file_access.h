@@ -139,10 +139,12 @@ protected:
 
 private:
 	static inline bool backup_save = false;
+	static inline thread_local bool thread_backup_save = false;
 	static inline thread_local Error last_file_open_error = OK;
 
 	AccessType _access_type = ACCESS_FILESYSTEM;
 	static inline CreateFunc create_func[ACCESS_MAX]; /** default file access creation function for a platform */
+	static inline CreateFunc create_mapped_func = nullptr; /** read-only memory-mapped file access creation function, if the platform supports it */
 	template <typename T>
 	static Ref<FileAccess> _create_builtin() {
 		return memnew(T);
@@ -186,6 +188,10 @@ public:
 
 	virtual uint64_t get_buffer(uint8_t *p_dst, uint64_t p_length) const = 0; ///< get an array of bytes, needs to be overwritten by children.
 	Vector<uint8_t> get_buffer(int64_t p_length) const;
+	virtual const uint8_t *get_mapped_data() const { return nullptr; } ///< whole file contents if mapped in memory, valid while the file is open
+	virtual Vector<uint8_t> get_mapped_view(uint64_t p_offset, uint64_t p_length) const { return Vector<uint8_t>(); } ///< read-only array sharing memory with the file, copied on first write; empty if not possible
+	virtual void prefetch(uint64_t p_offset, uint64_t p_length) const {} ///< hint that a range will be read soon, so it can be fetched from storage in the background
+	Vector<uint8_t> get_buffer_view(int64_t p_length); ///< like get_buffer(), but sharing memory with the file when possible
 	virtual String get_line() const;
 	virtual String get_token() const;
 	virtual Vector<String> get_csv_line(const String &p_delim = ",") const;
@@ -237,6 +243,7 @@ public:
 	static Ref<FileAccess> create_for_path(const String &p_path);
 	static Ref<FileAccess> open(const String &p_path, int p_mode_flags, Error *r_error = nullptr); /// Create a file access (for the current platform) this is the only portable way of accessing files.
 	static Ref<FileAccess> create_temp(int p_mode_flags, const String &p_prefix = "", const String &p_extension = "", bool p_keep = false, Error *r_error = nullptr);
+	static Ref<FileAccess> open_mapped(const String &p_path, Error *r_error = nullptr); /// Map a file for reading, bypassing packs. Fails with ERR_UNAVAILABLE if the platform can't map files.
 
 	static Ref<FileAccess> open_encrypted(const String &p_path, ModeFlags p_mode_flags, const Vector<uint8_t> &p_key, const Vector<uint8_t> &p_iv = Vector<uint8_t>());
 	static Ref<FileAccess> open_encrypted_pass(const String &p_path, ModeFlags p_mode_flags, const String &p_pass);
@@ -257,7 +264,8 @@ public:
 	static Error set_read_only_attribute(const String &p_file, bool p_ro);
 
 	static void set_backup_save(bool p_enable) { backup_save = p_enable; }
-	static bool is_backup_save_enabled() { return backup_save; }
+	static bool is_backup_save_enabled() { return backup_save || thread_backup_save; }
+	static void set_thread_backup_save(bool p_enable) { thread_backup_save = p_enable; } // Only for files opened on the calling thread.
 
 	static String get_md5(const String &p_file);
 	static String get_sha256(const String &p_file);
@@ -274,6 +282,11 @@ public:
 		create_func[p_access] = _create_builtin<T>;
 	}
 
+	template <typename T>
+	static void make_mapped_default() {
+		create_mapped_func = _create_builtin<T>;
+	}
+
 public:
 	FileAccess() {}
 	virtual ~FileAccess();
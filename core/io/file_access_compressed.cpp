@@ -63,18 +63,122 @@ Error FileAccessCompressed::open_after_magic(Ref<FileAccess> p_base) {
 
 	comp_buffer.resize(max_bs);
 	buffer.resize(block_size);
-	read_ptr = buffer.ptrw();
-	f->get_buffer(comp_buffer.ptrw(), read_blocks[0].csize);
 	at_end = false;
 	read_eof = false;
 	read_block_count = bc;
-	read_block_size = read_blocks.size() == 1 ? read_total : block_size;
-
-	int ret = Compression::decompress(buffer.ptrw(), read_block_size, comp_buffer.ptr(), read_blocks[0].csize, cmode);
-	read_block = 0;
 	read_pos = 0;
 
-	return ret == -1 ? ERR_FILE_CORRUPT : OK;
+	// Small files are decompressed block by block on the calling thread.
+	read_ahead_blocks = MAX(1u, READ_AHEAD_SIZE / block_size);
+	if (read_block_count <= read_ahead_blocks || !WorkerThreadPool::get_singleton()) {
+		read_ahead_blocks = 0;
+	}
+	read_ahead_current = 0;
+
+	return _load_block(0) ? OK : ERR_FILE_CORRUPT;
+}
+
+void FileAccessCompressed::_compress_block(uint32_t p_index, Vector<uint8_t> *p_blocks) {
+	const uint32_t bl = p_index == (write_max / block_size) ? write_max % block_size : block_size;
+	const uint8_t *bp = &write_ptr[uint64_t(p_index) * block_size];
+
+	Vector<uint8_t> &cblock = p_blocks[p_index];
+	cblock.resize(Compression::get_max_compressed_buffer_size(bl, cmode));
+	const int s = Compression::compress(cblock.ptrw(), bp, bl, cmode);
+	cblock.resize(MAX(s, 0));
+	ERR_FAIL_COND_MSG(s < 0, vformat("Failed to compress block %d of '%s'.", p_index, get_path()));
+}
+
+void FileAccessCompressed::_decompress_read_ahead(ReadAhead *p_read_ahead) const {
+	const uint8_t *src = p_read_ahead->compressed.ptr();
+	uint8_t *dst = p_read_ahead->data.ptrw();
+	for (uint32_t i = 0; i < p_read_ahead->block_count; i++) {
+		const uint32_t csize = read_blocks[p_read_ahead->first_block + i].csize;
+		if (Compression::decompress(dst, block_size, src, csize, cmode) == -1) {
+			p_read_ahead->failed = true;
+			return;
+		}
+		src += csize;
+		dst += block_size;
+	}
+}
+
+void FileAccessCompressed::_start_read_ahead(uint32_t p_first_block) const {
+	ReadAhead &ra = read_ahead[1 - read_ahead_current];
+	_wait_read_ahead(ra);
+
+	ra.first_block = p_first_block;
+	ra.block_count = MIN(read_ahead_blocks, read_block_count - p_first_block);
+	ra.failed = false;
+
+	// Compressed blocks are stored back to back, so the whole batch is read at once.
+	// Only decompression happens on the worker; the base file stays on this thread.
+	uint64_t csize = 0;
+	for (uint32_t i = 0; i < ra.block_count; i++) {
+		csize += read_blocks[p_first_block + i].csize;
+	}
+	ra.compressed.resize(csize);
+	ra.data.resize(uint64_t(ra.block_count) * block_size);
+	f->seek(read_blocks[p_first_block].offset);
+	if (f->get_buffer(ra.compressed.ptrw(), csize) != csize) {
+		ra.failed = true;
+		return;
+	}
+
+	ra.task = WorkerThreadPool::get_singleton()->add_template_task(this, &FileAccessCompressed::_decompress_read_ahead, &ra, false, "Decompress file blocks");
+}
+
+void FileAccessCompressed::_wait_read_ahead(ReadAhead &p_read_ahead) const {
+	if (p_read_ahead.task != WorkerThreadPool::INVALID_TASK_ID) {
+		WorkerThreadPool::get_singleton()->wait_for_task_completion(p_read_ahead.task);
+		p_read_ahead.task = WorkerThreadPool::INVALID_TASK_ID;
+	}
+}
+
+bool FileAccessCompressed::_load_block(uint32_t p_block) const {
+	read_block = p_block;
+	read_block_size = read_block == read_block_count - 1 ? read_total % block_size : block_size;
+
+	if (read_ahead_blocks) {
+		ReadAhead &current = read_ahead[read_ahead_current];
+		if (current.block_count && p_block >= current.first_block && p_block < current.first_block + current.block_count) {
+			read_ptr = current.data.ptrw() + uint64_t(p_block - current.first_block) * block_size;
+			return true;
+		}
+
+		ReadAhead &next = read_ahead[1 - read_ahead_current];
+		if (next.block_count && p_block >= next.first_block && p_block < next.first_block + next.block_count) {
+			// Reading went on into the batch decompressed in the background,
+			// make it current and start on the one after it.
+			_wait_read_ahead(next);
+			read_ahead_current = 1 - read_ahead_current;
+			if (next.failed) {
+				next.block_count = 0;
+				return false;
+			}
+			read_ptr = next.data.ptrw() + uint64_t(p_block - next.first_block) * block_size;
+
+			const uint32_t following = next.first_block + next.block_count;
+			if (following < read_block_count) {
+				_start_read_ahead(following);
+			}
+			return true;
+		}
+	}
+
+	f->seek(read_blocks[p_block].offset);
+	f->get_buffer(comp_buffer.ptrw(), read_blocks[p_block].csize);
+	int ret = Compression::decompress(buffer.ptrw(), read_blocks.size() == 1 ? read_total : block_size, comp_buffer.ptr(), read_blocks[p_block].csize, cmode);
+	read_ptr = buffer.ptrw();
+
+	if (read_ahead_blocks && p_block + 1 < read_block_count) {
+		const ReadAhead &next = read_ahead[1 - read_ahead_current];
+		if (!next.block_count || next.first_block != p_block + 1) {
+			_start_read_ahead(p_block + 1);
+		}
+	}
+
+	return ret != -1;
 }
 
 Error FileAccessCompressed::open_internal(const String &p_path, int p_mode_flags) {
@@ -128,33 +232,38 @@ void FileAccessCompressed::_close() {
 		f->store_32(uint32_t(write_max)); //max amount of data written 4
 		uint32_t bc = (write_max / block_size) + 1;
 
-		for (uint32_t i = 0; i < bc; i++) {
-			f->store_32(0); //compressed sizes, will update later
+		// Blocks are compressed independently, so spread them over the worker threads.
+		LocalVector<Vector<uint8_t>> cblocks;
+		cblocks.resize(bc);
+		// Not from inside a pool task, where waiting on the group could hold the thread its blocks need.
+		if (bc > 1 && WorkerThreadPool::get_singleton() && WorkerThreadPool::get_singleton()->get_thread_index() == -1) {
+			WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &FileAccessCompressed::_compress_block, cblocks.ptr(), bc, -1, true, "Compress file blocks");
+			WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+		} else {
+			for (uint32_t i = 0; i < bc; i++) {
+				_compress_block(i, cblocks.ptr());
+			}
 		}
 
-		Vector<int> block_sizes;
 		for (uint32_t i = 0; i < bc; i++) {
-			uint32_t bl = i == (bc - 1) ? write_max % block_size : block_size;
-			uint8_t *bp = &write_ptr[i * block_size];
-
-			Vector<uint8_t> cblock;
-			cblock.resize(Compression::get_max_compressed_buffer_size(bl, cmode));
-			int s = Compression::compress(cblock.ptrw(), bp, bl, cmode);
-
-			f->store_buffer(cblock.ptr(), s);
-			block_sizes.push_back(s);
+			f->store_32(uint32_t(cblocks[i].size())); //compressed sizes
 		}
-
-		f->seek(16); //ok write block sizes
 		for (uint32_t i = 0; i < bc; i++) {
-			f->store_32(uint32_t(block_sizes[i]));
+			f->store_buffer(cblocks[i].ptr(), cblocks[i].size());
 		}
-		f->seek_end();
 		f->store_buffer((const uint8_t *)mgc.get_data(), mgc.length()); //magic at the end too
 
 		buffer.clear();
 
 	} else {
+		for (ReadAhead &ra : read_ahead) {
+			_wait_read_ahead(ra);
+			ra.block_count = 0;
+			ra.compressed.clear();
+			ra.data.clear();
+		}
+		read_ahead_blocks = 0;
+		read_ptr = nullptr;
 		comp_buffer.clear();
 		buffer.clear();
 		read_blocks.clear();
@@ -199,12 +308,7 @@ void FileAccessCompressed::seek(uint64_t p_position) {
 			read_eof = false;
 			uint32_t block_idx = p_position / block_size;
 			if (block_idx != read_block) {
-				read_block = block_idx;
-				f->seek(read_blocks[read_block].offset);
-				f->get_buffer(comp_buffer.ptrw(), read_blocks[read_block].csize);
-				int ret = Compression::decompress(buffer.ptrw(), read_blocks.size() == 1 ? read_total : block_size, comp_buffer.ptr(), read_blocks[read_block].csize, cmode);
-				ERR_FAIL_COND_MSG(ret == -1, "Compressed file is corrupt.");
-				read_block_size = read_block == read_block_count - 1 ? read_total % block_size : block_size;
+				ERR_FAIL_COND_MSG(!_load_block(block_idx), "Compressed file is corrupt.");
 			}
 
 			read_pos = p_position % block_size;
@@ -288,11 +392,8 @@ uint64_t FileAccessCompressed::get_buffer(uint8_t *p_dst, uint64_t p_length) con
 			return dst_idx;
 		}
 
-		// Read the next block of compressed data.
-		f->get_buffer(comp_buffer.ptrw(), read_blocks[read_block].csize);
-		int ret = Compression::decompress(buffer.ptrw(), read_blocks.size() == 1 ? read_total : block_size, comp_buffer.ptr(), read_blocks[read_block].csize, cmode);
-		ERR_FAIL_COND_V_MSG(ret == -1, -1, "Compressed file is corrupt.");
-		read_block_size = read_block == read_block_count - 1 ? read_total % block_size : block_size;
+		// Decompress the next block, or pick it up from the read-ahead.
+		ERR_FAIL_COND_V_MSG(!_load_block(read_block), -1, "Compressed file is corrupt.");
 		read_pos = 0;
 	}
 
@@ -34,6 +34,7 @@
 
 #include "core/io/compression.h"
 #include "core/io/file_access.h"
+#include "core/object/worker_thread_pool.h"
 
 class FileAccessCompressed : public FileAccess {
 	GDSOFTCLASS(FileAccessCompressed, FileAccess);
@@ -52,19 +53,40 @@ class FileAccessCompressed : public FileAccess {
 		uint64_t offset;
 	};
 
+	// Blocks following the one being read are decompressed ahead of time on
+	// the WorkerThreadPool, in batches of about this many bytes.
+	static constexpr uint32_t READ_AHEAD_SIZE = 256 * 1024;
+
+	struct ReadAhead {
+		uint32_t first_block = 0;
+		uint32_t block_count = 0;
+		Vector<uint8_t> compressed;
+		Vector<uint8_t> data;
+		WorkerThreadPool::TaskID task = WorkerThreadPool::INVALID_TASK_ID;
+		bool failed = false;
+	};
+
 	mutable Vector<uint8_t> comp_buffer;
-	uint8_t *read_ptr = nullptr;
+	mutable uint8_t *read_ptr = nullptr;
 	mutable uint32_t read_block = 0;
 	uint32_t read_block_count = 0;
 	mutable uint32_t read_block_size = 0;
 	mutable uint64_t read_pos = 0;
 	Vector<ReadBlock> read_blocks;
 	uint64_t read_total = 0;
+	uint32_t read_ahead_blocks = 0;
+	mutable ReadAhead read_ahead[2];
+	mutable uint32_t read_ahead_current = 0;
 
 	String magic = "GCMP";
 	mutable Vector<uint8_t> buffer;
 	Ref<FileAccess> f;
 
+	void _compress_block(uint32_t p_index, Vector<uint8_t> *p_blocks);
+	void _decompress_read_ahead(ReadAhead *p_read_ahead) const;
+	void _start_read_ahead(uint32_t p_first_block) const;
+	void _wait_read_ahead(ReadAhead &p_read_ahead) const;
+	bool _load_block(uint32_t p_block) const;
 	void _close();
 
 public:
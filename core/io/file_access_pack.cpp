@@ -47,7 +47,7 @@ Error PackedData::add_pack(const String &p_path, bool p_replace_files, uint64_t
 	return ERR_FILE_UNRECOGNIZED;
 }
 
-void PackedData::add_path(const String &p_pkg_path, const String &p_path, uint64_t p_ofs, uint64_t p_size, const uint8_t *p_md5, PackSource *p_src, bool p_replace_files, bool p_encrypted) {
+void PackedData::add_path(const String &p_pkg_path, const String &p_path, uint64_t p_ofs, uint64_t p_size, const uint8_t *p_md5, PackSource *p_src, bool p_replace_files, bool p_encrypted, const Ref<FileAccess> &p_mapped_pack) {
 	String simplified_path = p_path.simplify_path().trim_prefix("res://");
 	PathMD5 pmd5(simplified_path.md5_buffer());
 
@@ -62,6 +62,7 @@ void PackedData::add_path(const String &p_pkg_path, const String &p_path, uint64
 		pf.md5[i] = p_md5[i];
 	}
 	pf.src = p_src;
+	pf.mapped_pack = p_mapped_pack;
 
 	if (!exists || p_replace_files) {
 		files[pmd5] = pf;
@@ -138,6 +139,16 @@ uint8_t *PackedData::get_file_hash(const String &p_path) {
 	return E->value.md5;
 }
 
+void PackedData::prefetch(const String &p_path) const {
+	String simplified_path = p_path.simplify_path().trim_prefix("res://");
+	HashMap<PathMD5, PackedFile, PathMD5>::ConstIterator E = files.find(PathMD5(simplified_path.md5_buffer()));
+	if (!E || E->value.mapped_pack.is_null()) {
+		return;
+	}
+
+	E->value.mapped_pack->prefetch(E->value.offset, E->value.size);
+}
+
 HashSet<String> PackedData::get_file_paths() const {
 	HashSet<String> file_paths;
 	_get_file_paths(root, root->name, file_paths);
@@ -283,6 +294,13 @@ bool PackedSourcePCK::try_open_pack(const String &p_path, bool p_replace_files,
 		file_base += pck_start_pos;
 	}
 
+	// Map the pack if possible, so its files can be read without seeking and copying through a file handle.
+	// Packs within packs can't be mapped, as they aren't in the file system.
+	Ref<FileAccess> mapped_pack;
+	if (!PackedData::get_singleton()->has_path(p_path)) {
+		mapped_pack = FileAccess::open_mapped(p_path);
+	}
+
 	if (enc_directory) {
 		Ref<FileAccessEncrypted> fae;
 		fae.instantiate();
@@ -316,7 +334,7 @@ bool PackedSourcePCK::try_open_pack(const String &p_path, bool p_replace_files,
 		if (flags & PACK_FILE_REMOVAL) { // The file was removed.
 			PackedData::get_singleton()->remove_path(path);
 		} else {
-			PackedData::get_singleton()->add_path(p_path, path, file_base + ofs + p_offset, size, md5, this, p_replace_files, (flags & PACK_FILE_ENCRYPTED));
+			PackedData::get_singleton()->add_path(p_path, path, file_base + ofs + p_offset, size, md5, this, p_replace_files, (flags & PACK_FILE_ENCRYPTED), mapped_pack);
 		}
 	}
 
@@ -389,7 +407,9 @@ void FileAccessPack::seek(uint64_t p_position) {
 		eof = false;
 	}
 
-	f->seek(off + p_position);
+	if (!mapped_data) {
+		f->seek(off + p_position);
+	}
 	pos = p_position;
 }
 
@@ -423,21 +443,34 @@ uint64_t FileAccessPack::get_buffer(uint8_t *p_dst, uint64_t p_length) const {
 		to_read = (int64_t)pf.size - (int64_t)pos;
 	}
 
-	pos += to_read;
-
 	if (to_read <= 0) {
 		return 0;
 	}
-	f->get_buffer(p_dst, to_read);
+
+	if (mapped_data) {
+		memcpy(p_dst, mapped_data + pos, to_read);
+	} else {
+		f->get_buffer(p_dst, to_read);
+	}
+	pos += to_read;
 
 	return to_read;
 }
 
+Vector<uint8_t> FileAccessPack::get_mapped_view(uint64_t p_offset, uint64_t p_length) const {
+	if (!mapped_data || p_offset + p_length > pf.size) {
+		return Vector<uint8_t>();
+	}
+	return f->get_mapped_view(pf.offset + p_offset, p_length);
+}
+
 void FileAccessPack::set_big_endian(bool p_big_endian) {
 	ERR_FAIL_COND_MSG(f.is_null(), "File must be opened before use.");
 
 	FileAccess::set_big_endian(p_big_endian);
-	f->set_big_endian(p_big_endian);
+	if (!mapped_data) {
+		f->set_big_endian(p_big_endian);
+	}
 }
 
 Error FileAccessPack::get_error() const {
@@ -461,15 +494,26 @@ bool FileAccessPack::file_exists(const String &p_name) {
 
 void FileAccessPack::close() {
 	f = Ref<FileAccess>();
+	mapped_data = nullptr;
 }
 
 FileAccessPack::FileAccessPack(const String &p_path, const PackedData::PackedFile &p_file) :
-		pf(p_file),
-		f(FileAccess::open(pf.pack, FileAccess::READ)) {
+		pf(p_file) {
+	pos = 0;
+	eof = false;
+	off = pf.offset;
+
+	if (!pf.encrypted && pf.mapped_pack.is_valid() && pf.mapped_pack->get_mapped_data() && pf.offset + pf.size <= pf.mapped_pack->get_length()) {
+		// Shared by all the files of the pack, which only read its memory.
+		f = pf.mapped_pack;
+		mapped_data = f->get_mapped_data() + pf.offset;
+		return;
+	}
+
+	f = FileAccess::open(pf.pack, FileAccess::READ);
 	ERR_FAIL_COND_MSG(f.is_null(), vformat("Can't open pack-referenced file '%s'.", String(pf.pack)));
 
 	f->seek(pf.offset);
-	off = pf.offset;
 
 	if (pf.encrypted) {
 		Ref<FileAccessEncrypted> fae;
@@ -487,8 +531,6 @@ FileAccessPack::FileAccessPack(const String &p_path, const PackedData::PackedFil
 		f = fae;
 		off = 0;
 	}
-	pos = 0;
-	eof = false;
 }
 
 //////////////////////////////////////////////////////////////////////////////////
@@ -49,15 +49,102 @@ const char *JSON::tk_name[TK_MAX] = {
 	"EOF",
 };
 
-void JSON::_add_indent(String &r_result, const String &p_indent, int p_size) {
+void JSON::_add_indent(LocalVector<char32_t> &r_buffer, const String &p_indent, int p_size) {
 	for (int i = 0; i < p_size; i++) {
-		r_result += p_indent;
+		_append(r_buffer, p_indent);
 	}
 }
 
-void JSON::_stringify(String &r_result, const Variant &p_var, const String &p_indent, int p_cur_indent, bool p_sort_keys, HashSet<const void *> &p_markers, bool p_full_precision) {
+void JSON::_append(LocalVector<char32_t> &r_buffer, const char *p_str) {
+	while (*p_str) {
+		r_buffer.push_back(*p_str++);
+	}
+}
+
+void JSON::_append(LocalVector<char32_t> &r_buffer, const String &p_str) {
+	const uint32_t size = r_buffer.size();
+	r_buffer.resize(size + p_str.length());
+	memcpy(r_buffer.ptr() + size, p_str.ptr(), p_str.length() * sizeof(char32_t));
+}
+
+void JSON::_append_int(LocalVector<char32_t> &r_buffer, int64_t p_num) {
+	char digits[24];
+	int count = 0;
+	uint64_t value = p_num < 0 ? uint64_t(0) - uint64_t(p_num) : uint64_t(p_num);
+	do {
+		digits[count++] = '0' + value % 10;
+		value /= 10;
+	} while (value);
+	if (p_num < 0) {
+		r_buffer.push_back('-');
+	}
+	while (count) {
+		r_buffer.push_back(digits[--count]);
+	}
+}
+
+void JSON::_append_float(LocalVector<char32_t> &r_buffer, double p_num, bool p_full_precision) {
+	// Only for exactly 0. If we have approximately 0 let the user decide how much
+	// precision they want.
+	if (p_num == double(0)) {
+		_append(r_buffer, "0.0");
+		return;
+	}
+
+	double magnitude = std::log10(Math::abs(p_num));
+	int total_digits = p_full_precision ? 17 : 14;
+	int precision = MAX(1, total_digits - (int)Math::floor(magnitude));
+
+	_append(r_buffer, String::num(p_num, precision));
+}
+
+void JSON::_append_escaped(LocalVector<char32_t> &r_buffer, const String &p_str) {
+	r_buffer.push_back('"');
+	const char32_t *src = p_str.ptr();
+	const int len = p_str.length();
+	for (int i = 0; i < len; i++) {
+		const char32_t c = src[i];
+		char32_t escaped = 0;
+		switch (c) {
+			case '\\':
+				escaped = '\\';
+				break;
+			case '\b':
+				escaped = 'b';
+				break;
+			case '\f':
+				escaped = 'f';
+				break;
+			case '\n':
+				escaped = 'n';
+				break;
+			case '\r':
+				escaped = 'r';
+				break;
+			case '\t':
+				escaped = 't';
+				break;
+			case '\v':
+				escaped = 'v';
+				break;
+			case '"':
+				escaped = '"';
+				break;
+		}
+		if (escaped) {
+			r_buffer.push_back('\\');
+			r_buffer.push_back(escaped);
+		} else {
+			r_buffer.push_back(c);
+		}
+	}
+	r_buffer.push_back('"');
+}
+
+// Writes to a flat buffer, so no intermediate String is built for each value.
+void JSON::_stringify(LocalVector<char32_t> &r_buffer, const Variant &p_var, const String &p_indent, int p_cur_indent, bool p_sort_keys, HashSet<const void *> &p_markers, bool p_full_precision) {
 	if (p_cur_indent > Variant::MAX_RECURSION_DEPTH) {
-		r_result += "...";
+		_append(r_buffer, "...");
 		ERR_FAIL_MSG("JSON structure is too deep. Bailing.");
 	}
 
@@ -66,50 +153,85 @@ void JSON::_stringify(String &r_result, const Variant &p_var, const String &p_in
 
 	switch (p_var.get_type()) {
 		case Variant::NIL:
-			r_result += "null";
+			_append(r_buffer, "null");
 			return;
 		case Variant::BOOL:
-			r_result += p_var.operator bool() ? "true" : "false";
+			_append(r_buffer, p_var.operator bool() ? "true" : "false");
 			return;
 		case Variant::INT:
-			r_result += itos(p_var);
+			_append_int(r_buffer, p_var);
 			return;
-		case Variant::FLOAT: {
-			double num = p_var;
-
-			// Only for exactly 0. If we have approximately 0 let the user decide how much
-			// precision they want.
-			if (num == double(0)) {
-				r_result += "0.0";
+		case Variant::FLOAT:
+			_append_float(r_buffer, p_var, p_full_precision);
+			return;
+		case Variant::PACKED_INT32_ARRAY:
+		case Variant::PACKED_INT64_ARRAY:
+		case Variant::PACKED_FLOAT32_ARRAY:
+		case Variant::PACKED_FLOAT64_ARRAY: {
+			// Numbers are written straight from the packed array, without converting it to an Array first.
+			int size = 0;
+			switch (p_var.get_type()) {
+				case Variant::PACKED_INT32_ARRAY:
+					size = VariantInternal::get_int32_array(&p_var)->size();
+					break;
+				case Variant::PACKED_INT64_ARRAY:
+					size = VariantInternal::get_int64_array(&p_var)->size();
+					break;
+				case Variant::PACKED_FLOAT32_ARRAY:
+					size = VariantInternal::get_float32_array(&p_var)->size();
+					break;
+				default:
+					size = VariantInternal::get_float64_array(&p_var)->size();
+					break;
+			}
+			if (size == 0) {
+				_append(r_buffer, "[]");
 				return;
 			}
 
-			double magnitude = std::log10(Math::abs(num));
-			int total_digits = p_full_precision ? 17 : 14;
-			int precision = MAX(1, total_digits - (int)Math::floor(magnitude));
-
-			r_result += String::num(num, precision);
+			r_buffer.push_back('[');
+			_append(r_buffer, end_statement);
+			for (int i = 0; i < size; i++) {
+				if (i > 0) {
+					r_buffer.push_back(',');
+					_append(r_buffer, end_statement);
+				}
+				_add_indent(r_buffer, p_indent, p_cur_indent + 1);
+				switch (p_var.get_type()) {
+					case Variant::PACKED_INT32_ARRAY:
+						_append_int(r_buffer, VariantInternal::get_int32_array(&p_var)->get(i));
+						break;
+					case Variant::PACKED_INT64_ARRAY:
+						_append_int(r_buffer, VariantInternal::get_int64_array(&p_var)->get(i));
+						break;
+					case Variant::PACKED_FLOAT32_ARRAY:
+						_append_float(r_buffer, VariantInternal::get_float32_array(&p_var)->get(i), false);
+						break;
+					default:
+						_append_float(r_buffer, VariantInternal::get_float64_array(&p_var)->get(i), false);
+						break;
+				}
+			}
+			_append(r_buffer, end_statement);
+			_add_indent(r_buffer, p_indent, p_cur_indent);
+			r_buffer.push_back(']');
 			return;
 		}
-		case Variant::PACKED_INT32_ARRAY:
-		case Variant::PACKED_INT64_ARRAY:
-		case Variant::PACKED_FLOAT32_ARRAY:
-		case Variant::PACKED_FLOAT64_ARRAY:
 		case Variant::PACKED_STRING_ARRAY:
 		case Variant::ARRAY: {
 			Array a = p_var;
 			if (p_markers.has(a.id())) {
-				r_result += "\"[...]\"";
+				_append(r_buffer, "\"[...]\"");
 				ERR_FAIL_MSG("Converting circular structure to JSON.");
 			}
 
 			if (a.is_empty()) {
-				r_result += "[]";
+				_append(r_buffer, "[]");
 				return;
 			}
 
-			r_result += '[';
-			r_result += end_statement;
+			r_buffer.push_back('[');
+			_append(r_buffer, end_statement);
 
 			p_markers.insert(a.id());
 
@@ -118,27 +240,27 @@ void JSON::_stringify(String &r_result, const Variant &p_var, const String &p_in
 				if (first) {
 					first = false;
 				} else {
-					r_result += ',';
-					r_result += end_statement;
+					r_buffer.push_back(',');
+					_append(r_buffer, end_statement);
 				}
-				_add_indent(r_result, p_indent, p_cur_indent + 1);
-				_stringify(r_result, var, p_indent, p_cur_indent + 1, p_sort_keys, p_markers);
+				_add_indent(r_buffer, p_indent, p_cur_indent + 1);
+				_stringify(r_buffer, var, p_indent, p_cur_indent + 1, p_sort_keys, p_markers);
 			}
-			r_result += end_statement;
-			_add_indent(r_result, p_indent, p_cur_indent);
-			r_result += ']';
+			_append(r_buffer, end_statement);
+			_add_indent(r_buffer, p_indent, p_cur_indent);
+			r_buffer.push_back(']');
 			p_markers.erase(a.id());
 			return;
 		}
 		case Variant::DICTIONARY: {
 			Dictionary d = p_var;
 			if (p_markers.has(d.id())) {
-				r_result += "\"{...}\"";
+				_append(r_buffer, "\"{...}\"");
 				ERR_FAIL_MSG("Converting circular structure to JSON.");
 			}
 
-			r_result += '{';
-			r_result += end_statement;
+			r_buffer.push_back('{');
+			_append(r_buffer, end_statement);
 			p_markers.insert(d.id());
 
 			LocalVector<Variant> keys = d.get_key_list();
@@ -152,30 +274,139 @@ void JSON::_stringify(String &r_result, const Variant &p_var, const String &p_in
 				if (first_key) {
 					first_key = false;
 				} else {
-					r_result += ',';
-					r_result += end_statement;
+					r_buffer.push_back(',');
+					_append(r_buffer, end_statement);
 				}
-				_add_indent(r_result, p_indent, p_cur_indent + 1);
-				_stringify(r_result, String(key), p_indent, p_cur_indent + 1, p_sort_keys, p_markers);
-				r_result += colon;
-				_stringify(r_result, d[key], p_indent, p_cur_indent + 1, p_sort_keys, p_markers);
+				_add_indent(r_buffer, p_indent, p_cur_indent + 1);
+				if (key.get_type() == Variant::STRING) {
+					_append_escaped(r_buffer, *VariantInternal::get_string(&key));
+				} else {
+					_append_escaped(r_buffer, String(key));
+				}
+				_append(r_buffer, colon);
+				_stringify(r_buffer, d[key], p_indent, p_cur_indent + 1, p_sort_keys, p_markers);
 			}
 
-			r_result += end_statement;
-			_add_indent(r_result, p_indent, p_cur_indent);
-			r_result += '}';
+			_append(r_buffer, end_statement);
+			_add_indent(r_buffer, p_indent, p_cur_indent);
+			r_buffer.push_back('}');
 			p_markers.erase(d.id());
 			return;
 		}
+		case Variant::STRING:
+			_append_escaped(r_buffer, *VariantInternal::get_string(&p_var));
+			return;
 		default:
-			r_result += '"';
-			r_result += String(p_var).json_escape();
-			r_result += '"';
+			_append_escaped(r_buffer, String(p_var));
 			return;
 	}
 }
 
-Error JSON::_get_token(const char32_t *p_str, int &index, int p_len, Token &r_token, int &line, String &r_err_str) {
+// Characters that end a run of plain characters in a string.
+static _FORCE_INLINE_ bool _is_string_special(uint32_t p_char) {
+	return p_char == '"' || p_char == '\\' || p_char == '\n' || p_char == 0;
+}
+
+static _FORCE_INLINE_ int _scan_string_run(const char32_t *p_str, int p_index, int p_len) {
+	int end = p_index;
+	while (end < p_len && !_is_string_special(p_str[end])) {
+		end++;
+	}
+	return end;
+}
+
+// UTF-8 input is scanned eight bytes at a time, looking for any special byte in a single 64-bit word.
+static _FORCE_INLINE_ int _scan_string_run(const uint8_t *p_str, int p_index, int p_len) {
+	constexpr uint64_t ONES = 0x0101010101010101ULL;
+	constexpr uint64_t HIGHS = 0x8080808080808080ULL;
+	int end = p_index;
+	while (end + 8 <= p_len) {
+		uint64_t word;
+		memcpy(&word, p_str + end, 8);
+		const uint64_t quote = word ^ (ONES * '"');
+		const uint64_t backslash = word ^ (ONES * '\\');
+		const uint64_t newline = word ^ (ONES * '\n');
+		// A byte of any of these is zero where the input has a special byte, or where it has a zero byte.
+		const uint64_t special = ((quote - ONES) & ~quote) | ((backslash - ONES) & ~backslash) | ((newline - ONES) & ~newline) | ((word - ONES) & ~word);
+		if (special & HIGHS) {
+			break;
+		}
+		end += 8;
+	}
+	while (end < p_len && !_is_string_special(p_str[end])) {
+		end++;
+	}
+	return end;
+}
+
+static _FORCE_INLINE_ void _append_string_run(String &r_str, const char32_t *p_run, int p_len) {
+	r_str.append_utf32(Span(p_run, p_len));
+}
+
+static _FORCE_INLINE_ void _append_string_run(String &r_str, const uint8_t *p_run, int p_len) {
+	r_str.append_utf8((const char *)p_run, p_len);
+}
+
+static _FORCE_INLINE_ bool _is_number_char(uint32_t p_char) {
+	return is_digit(p_char) || p_char == '-' || p_char == '+' || p_char == '.' || p_char == 'e' || p_char == 'E';
+}
+
+// Returns false if the number isn't an integer, or doesn't fit in an int64_t. It's then only kept as a float.
+static _FORCE_INLINE_ bool _parse_integer(const char32_t *p_str, int p_len, int64_t &r_int_value) {
+	const bool negative = p_len > 0 && p_str[0] == '-';
+	const uint64_t limit = negative ? uint64_t(INT64_MAX) + 1 : uint64_t(INT64_MAX);
+	uint64_t value = 0;
+	for (int i = negative ? 1 : 0; i < p_len; i++) {
+		if (!is_digit(p_str[i])) {
+			return false;
+		}
+		const uint64_t digit = p_str[i] - '0';
+		if (value > (limit - digit) / 10) {
+			return false;
+		}
+		value = value * 10 + digit;
+	}
+	r_int_value = (negative && value > 0) ? -int64_t(value - 1) - 1 : int64_t(value);
+	return true;
+}
+
+static _FORCE_INLINE_ double _parse_number(const char32_t *p_str, int &r_index, bool &r_is_integer, int64_t &r_int_value) {
+	const char32_t *rptr;
+	double number = String::to_float(&p_str[r_index], &rptr);
+	const int len = rptr - &p_str[r_index];
+	r_is_integer = len > 0 && _parse_integer(&p_str[r_index], len, r_int_value);
+	r_index += len;
+	return number;
+}
+
+static _FORCE_INLINE_ double _parse_number(const uint8_t *p_str, int &r_index, bool &r_is_integer, int64_t &r_int_value) {
+	// Numbers are ASCII, so the characters that may be part of one are widened to parse them like above.
+	int len = 0;
+	while (_is_number_char(p_str[r_index + len])) {
+		len++;
+	}
+
+	char32_t number_text_buffer[64];
+	LocalVector<char32_t> number_text_long;
+	char32_t *number_text = number_text_buffer;
+	if (len >= 64) {
+		number_text_long.resize(len + 1);
+		number_text = number_text_long.ptr();
+	}
+	for (int i = 0; i < len; i++) {
+		number_text[i] = p_str[r_index + i];
+	}
+	number_text[len] = 0;
+
+	// Only what was actually parsed is consumed, the rest is left to the next token.
+	int index = 0;
+	double number = _parse_number(number_text, index, r_is_integer, r_int_value);
+	r_index += index;
+	return number;
+}
+
+template <typename C>
+Error JSON::_get_token(const C *p_str, int &index, int p_len, Token &r_token, int &line, String &r_err_str) {
 	while (p_len > 0) {
 		switch (p_str[index]) {
 			case '\n': {
@@ -221,6 +452,13 @@ Error JSON::_get_token(const char32_t *p_str, int &index, int p_len, Token &r_to
 				index++;
 				String str;
 				while (true) {
+					// Copy runs of plain characters in one go.
+					const int run_end = _scan_string_run(p_str, index, p_len);
+					if (run_end > index) {
+						_append_string_run(str, p_str + index, run_end - index);
+						index = run_end;
+					}
+
 					if (p_str[index] == 0) {
 						r_err_str = "Unterminated string";
 						return ERR_PARSE_ERROR;
@@ -345,9 +583,8 @@ Error JSON::_get_token(const char32_t *p_str, int &index, int p_len, Token &r_to
 						str += res;
 
 					} else {
-						if (p_str[index] == '\n') {
-							line++;
-						}
+						// Only a new line is left.
+						line++;
 						str += p_str[index];
 					}
 					index++;
@@ -366,11 +603,13 @@ Error JSON::_get_token(const char32_t *p_str, int &index, int p_len, Token &r_to
 
 				if (p_str[index] == '-' || is_digit(p_str[index])) {
 					//a number
-					const char32_t *rptr;
-					double number = String::to_float(&p_str[index], &rptr);
-					index += (rptr - &p_str[index]);
+					const int number_start = index;
 					r_token.type = TK_NUMBER;
-					r_token.value = number;
+					r_token.value = _parse_number(p_str, index, r_token.is_integer, r_token.int_value);
+					if (index == number_start) {
+						r_err_str = "Invalid number";
+						return ERR_PARSE_ERROR;
+					}
 					return OK;
 
 				} else if (is_ascii_alphabet_char(p_str[index])) {
@@ -396,7 +635,8 @@ Error JSON::_get_token(const char32_t *p_str, int &index, int p_len, Token &r_to
 	return ERR_PARSE_ERROR;
 }
 
-Error JSON::_parse_value(Variant &value, Token &token, const char32_t *p_str, int &index, int p_len, int &line, int p_depth, String &r_err_str) {
+template <typename C>
+Error JSON::_parse_value(Variant &value, Token &token, const C *p_str, int &index, int p_len, int &line, int p_depth, bool p_typed_arrays, String &r_err_str) {
 	if (p_depth > Variant::MAX_RECURSION_DEPTH) {
 		r_err_str = "JSON structure is too deep";
 		return ERR_OUT_OF_MEMORY;
@@ -404,18 +644,16 @@ Error JSON::_parse_value(Variant &value, Token &token, const char32_t *p_str, in
 
 	if (token.type == TK_CURLY_BRACKET_OPEN) {
 		Dictionary d;
-		Error err = _parse_object(d, p_str, index, p_len, line, p_depth + 1, r_err_str);
+		Error err = _parse_object(d, p_str, index, p_len, line, p_depth + 1, p_typed_arrays, r_err_str);
 		if (err) {
 			return err;
 		}
 		value = d;
 	} else if (token.type == TK_BRACKET_OPEN) {
-		Array a;
-		Error err = _parse_array(a, p_str, index, p_len, line, p_depth + 1, r_err_str);
+		Error err = _parse_array(value, p_str, index, p_len, line, p_depth + 1, p_typed_arrays, r_err_str);
 		if (err) {
 			return err;
 		}
-		value = a;
 	} else if (token.type == TK_IDENTIFIER) {
 		String id = token.value;
 		if (id == "true") {
@@ -440,10 +678,18 @@ Error JSON::_parse_value(Variant &value, Token &token, const char32_t *p_str, in
 	return OK;
 }
 
-Error JSON::_parse_array(Array &array, const char32_t *p_str, int &index, int p_len, int &line, int p_depth, String &r_err_str) {
+template <typename C>
+Error JSON::_parse_array(Variant &r_array, const C *p_str, int &index, int p_len, int &line, int p_depth, bool p_typed_arrays, String &r_err_str) {
+	Array array;
 	Token token;
 	bool need_comma = false;
 
+	// With typed arrays, numbers are collected here until something else shows up.
+	bool numeric = p_typed_arrays;
+	bool integral = true;
+	LocalVector<double> numbers;
+	LocalVector<int64_t> integers;
+
 	while (index < p_len) {
 		Error err = _get_token(p_str, index, p_len, token, line, r_err_str);
 		if (err != OK) {
@@ -451,6 +697,21 @@ Error JSON::_parse_array(Array &array, const char32_t *p_str, int &index, int p_
 		}
 
 		if (token.type == TK_BRACKET_CLOSE) {
+			if (numeric && !numbers.is_empty()) {
+				if (integral) {
+					PackedInt64Array packed;
+					packed.resize(integers.size());
+					memcpy(packed.ptrw(), integers.ptr(), integers.size() * sizeof(int64_t));
+					r_array = packed;
+				} else {
+					PackedFloat64Array packed;
+					packed.resize(numbers.size());
+					memcpy(packed.ptrw(), numbers.ptr(), numbers.size() * sizeof(double));
+					r_array = packed;
+				}
+			} else {
+				r_array = array;
+			}
 			return OK;
 		}
 
@@ -464,8 +725,25 @@ Error JSON::_parse_array(Array &array, const char32_t *p_str, int &index, int p_
 			}
 		}
 
+		if (numeric) {
+			if (token.type == TK_NUMBER) {
+				numbers.push_back(token.value);
+				integers.push_back(token.int_value);
+				integral = integral && token.is_integer;
+				need_comma = true;
+				continue;
+			}
+
+			// Not homogeneous, go back to a regular array.
+			numeric = false;
+			array.resize(numbers.size());
+			for (uint32_t i = 0; i < numbers.size(); i++) {
+				array[i] = numbers[i];
+			}
+		}
+
 		Variant v;
-		err = _parse_value(v, token, p_str, index, p_len, line, p_depth, r_err_str);
+		err = _parse_value(v, token, p_str, index, p_len, line, p_depth, p_typed_arrays, r_err_str);
 		if (err) {
 			return err;
 		}
@@ -478,7 +756,8 @@ Error JSON::_parse_array(Array &array, const char32_t *p_str, int &index, int p_
 	return ERR_PARSE_ERROR;
 }
 
-Error JSON::_parse_object(Dictionary &object, const char32_t *p_str, int &index, int p_len, int &line, int p_depth, String &r_err_str) {
+template <typename C>
+Error JSON::_parse_object(Dictionary &object, const C *p_str, int &index, int p_len, int &line, int p_depth, bool p_typed_arrays, String &r_err_str) {
 	bool at_key = true;
 	String key;
 	Token token;
@@ -527,7 +806,7 @@ Error JSON::_parse_object(Dictionary &object, const char32_t *p_str, int &index,
 			}
 
 			Variant v;
-			err = _parse_value(v, token, p_str, index, p_len, line, p_depth, r_err_str);
+			err = _parse_value(v, token, p_str, index, p_len, line, p_depth, p_typed_arrays, r_err_str);
 			if (err) {
 				return err;
 			}
@@ -546,25 +825,24 @@ void JSON::set_data(const Variant &p_data) {
 	text.clear();
 }
 
-Error JSON::_parse_string(const String &p_json, Variant &r_ret, String &r_err_str, int &r_err_line) {
-	const char32_t *str = p_json.ptr();
+// The input must be followed by a zero, which ends strings and tokens.
+template <typename C>
+Error JSON::_parse(const C *p_str, int p_len, bool p_typed_arrays, Variant &r_ret, String &r_err_str, int &r_err_line) {
 	int idx = 0;
-	int len = p_json.length();
 	Token token;
 	r_err_line = 0;
-	String aux_key;
 
-	Error err = _get_token(str, idx, len, token, r_err_line, r_err_str);
+	Error err = _get_token(p_str, idx, p_len, token, r_err_line, r_err_str);
 	if (err) {
 		return err;
 	}
 
-	err = _parse_value(r_ret, token, str, idx, len, r_err_line, 0, r_err_str);
+	err = _parse_value(r_ret, token, p_str, idx, p_len, r_err_line, 0, p_typed_arrays, r_err_str);
 
 	// Check if EOF is reached
 	// or it's a type of the next token.
-	if (err == OK && idx < len) {
-		err = _get_token(str, idx, len, token, r_err_line, r_err_str);
+	if (err == OK && idx < p_len) {
+		err = _get_token(p_str, idx, p_len, token, r_err_line, r_err_str);
 
 		if (err || token.type != TK_EOF) {
 			r_err_str = "Expected 'EOF'";
@@ -577,6 +855,10 @@ Error JSON::_parse_string(const String &p_json, Variant &r_ret, String &r_err_st
 	return err;
 }
 
+Error JSON::_parse_string(const String &p_json, Variant &r_ret, String &r_err_str, int &r_err_line) {
+	return _parse(p_json.ptr(), p_json.length(), false, r_ret, r_err_str, r_err_line);
+}
+
 Error JSON::parse(const String &p_json_string, bool p_keep_text) {
 	Error err = _parse_string(p_json_string, data, err_str, err_line);
 	if (err == Error::OK) {
@@ -588,14 +870,31 @@ Error JSON::parse(const String &p_json_string, bool p_keep_text) {
 	return err;
 }
 
+Error JSON::parse_buffer(const PackedByteArray &p_json_buffer, bool p_typed_arrays) {
+	text.clear();
+	ERR_FAIL_COND_V_MSG(p_json_buffer.size() >= INT32_MAX, ERR_OUT_OF_MEMORY, "JSON buffer is too large.");
+
+	// Parsed as UTF-8 bytes, without decoding the whole text to a String first.
+	PackedByteArray terminated = p_json_buffer;
+	terminated.push_back(0);
+	Error err = _parse(terminated.ptr(), p_json_buffer.size(), p_typed_arrays, data, err_str, err_line);
+	if (err == Error::OK) {
+		err_line = 0;
+	}
+	return err;
+}
+
 String JSON::get_parsed_text() const {
 	return text;
 }
 
 String JSON::stringify(const Variant &p_var, const String &p_indent, bool p_sort_keys, bool p_full_precision) {
-	String result;
+	LocalVector<char32_t> buffer;
 	HashSet<const void *> markers;
-	_stringify(result, p_var, p_indent, 0, p_sort_keys, markers, p_full_precision);
+	_stringify(buffer, p_var, p_indent, 0, p_sort_keys, markers, p_full_precision);
+
+	String result;
+	result.append_utf32(Span(buffer.ptr(), buffer.size()));
 	return result;
 }
 
@@ -611,6 +910,7 @@ void JSON::_bind_methods() {
 	ClassDB::bind_static_method("JSON", D_METHOD("stringify", "data", "indent", "sort_keys", "full_precision"), &JSON::stringify, DEFVAL(""), DEFVAL(true), DEFVAL(false));
 	ClassDB::bind_static_method("JSON", D_METHOD("parse_string", "json_string"), &JSON::parse_string);
 	ClassDB::bind_method(D_METHOD("parse", "json_text", "keep_text"), &JSON::parse, DEFVAL(false));
+	ClassDB::bind_method(D_METHOD("parse_buffer", "json_buffer", "typed_arrays"), &JSON::parse_buffer, DEFVAL(false));
 
 	ClassDB::bind_method(D_METHOD("get_data"), &JSON::get_data);
 	ClassDB::bind_method(D_METHOD("set_data", "data"), &JSON::set_data);
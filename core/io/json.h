@@ -35,6 +35,7 @@
 #include "core/io/resource.h"
 #include "core/io/resource_loader.h"
 #include "core/io/resource_saver.h"
+#include "core/templates/local_vector.h"
 #include "core/variant/variant.h"
 
 class JSON : public Resource {
@@ -64,6 +65,8 @@ class JSON : public Resource {
 	struct Token {
 		TokenType type;
 		Variant value;
+		int64_t int_value = 0; // Exact value of numbers written without a fraction or exponent.
+		bool is_integer = false;
 	};
 
 	String text;
@@ -73,12 +76,23 @@ class JSON : public Resource {
 
 	static const char *tk_name[];
 
-	static void _add_indent(String &r_result, const String &p_indent, int p_size);
-	static void _stringify(String &r_result, const Variant &p_var, const String &p_indent, int p_cur_indent, bool p_sort_keys, HashSet<const void *> &p_markers, bool p_full_precision = false);
-	static Error _get_token(const char32_t *p_str, int &index, int p_len, Token &r_token, int &line, String &r_err_str);
-	static Error _parse_value(Variant &value, Token &token, const char32_t *p_str, int &index, int p_len, int &line, int p_depth, String &r_err_str);
-	static Error _parse_array(Array &array, const char32_t *p_str, int &index, int p_len, int &line, int p_depth, String &r_err_str);
-	static Error _parse_object(Dictionary &object, const char32_t *p_str, int &index, int p_len, int &line, int p_depth, String &r_err_str);
+	static void _add_indent(LocalVector<char32_t> &r_buffer, const String &p_indent, int p_size);
+	static void _append(LocalVector<char32_t> &r_buffer, const char *p_str);
+	static void _append(LocalVector<char32_t> &r_buffer, const String &p_str);
+	static void _append_int(LocalVector<char32_t> &r_buffer, int64_t p_num);
+	static void _append_float(LocalVector<char32_t> &r_buffer, double p_num, bool p_full_precision);
+	static void _append_escaped(LocalVector<char32_t> &r_buffer, const String &p_str);
+	static void _stringify(LocalVector<char32_t> &r_buffer, const Variant &p_var, const String &p_indent, int p_cur_indent, bool p_sort_keys, HashSet<const void *> &p_markers, bool p_full_precision = false);
+	template <typename C>
+	static Error _get_token(const C *p_str, int &index, int p_len, Token &r_token, int &line, String &r_err_str);
+	template <typename C>
+	static Error _parse_value(Variant &value, Token &token, const C *p_str, int &index, int p_len, int &line, int p_depth, bool p_typed_arrays, String &r_err_str);
+	template <typename C>
+	static Error _parse_array(Variant &r_array, const C *p_str, int &index, int p_len, int &line, int p_depth, bool p_typed_arrays, String &r_err_str);
+	template <typename C>
+	static Error _parse_object(Dictionary &object, const C *p_str, int &index, int p_len, int &line, int p_depth, bool p_typed_arrays, String &r_err_str);
+	template <typename C>
+	static Error _parse(const C *p_str, int p_len, bool p_typed_arrays, Variant &r_ret, String &r_err_str, int &r_err_line);
 	static Error _parse_string(const String &p_json, Variant &r_ret, String &r_err_str, int &r_err_line);
 
 	static Variant _from_native(const Variant &p_variant, bool p_full_objects, int p_depth);
@@ -89,6 +103,7 @@ protected:
 
 public:
 	Error parse(const String &p_json_string, bool p_keep_text = false);
+	Error parse_buffer(const PackedByteArray &p_json_buffer, bool p_typed_arrays = false);
 	String get_parsed_text() const;
 
 	static String stringify(const Variant &p_var, const String &p_indent = "", bool p_sort_keys = true, bool p_full_precision = false);
@@ -150,6 +150,7 @@ public:
 	Ref<Resource> _duplicate_from_variant(bool p_deep, ResourceDeepDuplicateMode p_deep_subresources_mode, int p_recursion_count) const;
 	static void _teardown_duplicate_from_variant();
 	Ref<Resource> duplicate_for_local_scene(Node *p_for_scene, HashMap<Ref<Resource>, Ref<Resource>> &p_remap_cache) const;
+	Ref<Resource> duplicate_deep_remapped(ResourceDeepDuplicateMode p_deep_subresources_mode, HashMap<Ref<Resource>, Ref<Resource>> &p_remap_cache) const; // The cache is filled with the copy made of each resource.
 	void configure_for_local_scene(Node *p_for_scene, HashMap<Ref<Resource>, Ref<Resource>> &p_remap_cache);
 
 	void set_local_to_scene(bool p_enable);
@@ -37,6 +37,7 @@
 #include "core/io/file_access_compressed.h"
 #include "core/io/missing_resource.h"
 #include "core/object/script_language.h"
+#include "core/object/worker_thread_pool.h"
 #include "core/version.h"
 
 //#define print_bl(m_what) print_line(m_what)
@@ -445,6 +446,8 @@ Error ResourceLoaderBinary::parse_variant(Variant &r_v) {
 					if (erindex < 0 || erindex >= external_resources.size()) {
 						WARN_PRINT("Broken external resource! (index out of size)");
 						r_v = Variant();
+					} else if (external_resources[erindex].resource.is_valid()) {
+						r_v = external_resources[erindex].resource;
 					} else {
 						Ref<ResourceLoader::LoadToken> &load_token = external_resources.write[erindex].load_token;
 						if (load_token.is_valid()) { // If not valid, it's OK since then we know this load accepts broken dependencies.
@@ -509,10 +512,8 @@ Error ResourceLoaderBinary::parse_variant(Variant &r_v) {
 		case VARIANT_PACKED_BYTE_ARRAY: {
 			uint32_t len = f->get_32();
 
-			Vector<uint8_t> array;
-			array.resize(len);
-			uint8_t *w = array.ptrw();
-			f->get_buffer(w, len);
+			// Large arrays in mapped packs share their memory until modified.
+			Vector<uint8_t> array = f->get_buffer_view(len);
 			_advance_padding(len);
 
 			r_v = array;
@@ -707,6 +708,8 @@ Error ResourceLoaderBinary::load() {
 		}
 	}
 
+	pending_resources.clear();
+
 	for (int i = 0; i < internal_resources.size(); i++) {
 		bool main = i == (internal_resources.size() - 1);
 
@@ -809,89 +812,67 @@ Error ResourceLoaderBinary::load() {
 			internal_index_cache[path] = res;
 		}
 
-		int pc = f->get_32();
-
-		//set properties
-
-		Dictionary missing_resource_properties;
-
-		for (int j = 0; j < pc; j++) {
-			StringName name = _get_string();
-
-			if (name == StringName()) {
-				error = ERR_FILE_CORRUPT;
-				ERR_FAIL_V(ERR_FILE_CORRUPT);
-			}
-
-			Variant value;
-
-			error = parse_variant(value);
-			if (error) {
-				return error;
-			}
+		PendingResource pending;
+		pending.resource = res;
+		pending.missing_resource = missing_resource;
+		pending.main = main;
+		pending.properties_offset = f->get_position();
+		pending_resources.push_back(pending);
 
-			bool set_valid = true;
-			if (value.get_type() == Variant::OBJECT && missing_resource == nullptr && ResourceLoader::is_creating_missing_resources_if_class_unavailable_enabled()) {
-				// If the property being set is a missing resource (and the parent is not),
-				// then setting it will most likely not work.
-				// Instead, save it as metadata.
+		if (main) {
+			break;
+		}
+	}
 
-				Ref<MissingResource> mr = value;
-				if (mr.is_valid()) {
-					missing_resource_properties[name] = mr;
-					set_valid = false;
-				}
-			}
+	// Every resource referenced by properties exists now, so they can be parsed on worker threads.
+	// Properties are still set in file order, keeping the same behavior as sequential loading.
+	if (use_sub_threads && !file_path.is_empty() && pending_resources.size() >= PARALLEL_PARSE_THRESHOLD) {
+		error = _resolve_external_resources();
+		if (error != OK) {
+			return error;
+		}
 
-			if (value.get_type() == Variant::ARRAY) {
-				Array set_array = value;
-				bool is_get_valid = false;
-				Variant get_value = res->get(name, &is_get_valid);
-				if (is_get_valid && get_value.get_type() == Variant::ARRAY) {
-					Array get_array = get_value;
-					if (!set_array.is_same_typed(get_array)) {
-						value = Array(set_array, get_array.get_typed_builtin(), get_array.get_typed_class_name(), get_array.get_typed_script());
-					}
-				}
-			}
+		next_pending_resource.set(0);
+		// High priority, since this thread is often a low-priority task itself, and the low-priority
+		// slots may all be taken by loads waiting like this one. It parses too rather than only waiting,
+		// so by the time it waits, every resource is being parsed by a running task.
+		const int tasks = MIN((int)pending_resources.size() - 1, WorkerThreadPool::get_singleton()->get_thread_count());
+		WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &ResourceLoaderBinary::_parse_properties_task, nullptr, tasks, -1, true, vformat("Parse resources in %s", local_path));
+		_parse_properties_task(tasks, nullptr);
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+	}
 
-			if (value.get_type() == Variant::DICTIONARY) {
-				Dictionary set_dict = value;
-				bool is_get_valid = false;
-				Variant get_value = res->get(name, &is_get_valid);
-				if (is_get_valid && get_value.get_type() == Variant::DICTIONARY) {
-					Dictionary get_dict = get_value;
-					if (!set_dict.is_same_typed(get_dict)) {
-						value = Dictionary(set_dict, get_dict.get_typed_key_builtin(), get_dict.get_typed_key_class_name(), get_dict.get_typed_key_script(),
-								get_dict.get_typed_value_builtin(), get_dict.get_typed_value_class_name(), get_dict.get_typed_value_script());
-					}
-				}
-			}
+	for (uint32_t i = 0; i < pending_resources.size(); i++) {
+		PendingResource &pending = pending_resources[i];
 
-			if (set_valid) {
-				res->set(name, value);
-			}
+		if (!pending.parsed) {
+			f->seek(pending.properties_offset);
+			_parse_properties(*this, pending);
 		}
-
-		if (missing_resource) {
-			missing_resource->set_recording_properties(false);
+		if (pending.parse_error != OK) {
+			error = pending.parse_error;
+			return error;
 		}
 
-		if (!missing_resource_properties.is_empty()) {
-			res->set_meta(META_MISSING_RESOURCES, missing_resource_properties);
+		error = _set_properties(pending);
+		if (error != OK) {
+			return error;
 		}
 
+		Ref<Resource> res = pending.resource;
+
 #ifdef TOOLS_ENABLED
 		res->set_edited(false);
 #endif
 
 		if (progress) {
-			*progress = (i + 1) / float(internal_resources.size());
+			*progress = (i + 1) / float(pending_resources.size());
 		}
 
 		resource_cache.push_back(res);
 
-		if (main) {
+		if (pending.main) {
+			pending_resources.clear();
 			f.unref();
 			resource = res;
 			resource->set_as_translation_remapped(translation_remapped);
@@ -903,6 +884,166 @@ Error ResourceLoaderBinary::load() {
 	return ERR_FILE_EOF;
 }
 
+Error ResourceLoaderBinary::_resolve_external_resources() {
+	// Wait for dependencies here, so worker threads only read them.
+	for (ExtResource &er : external_resources) {
+		if (er.load_token.is_null()) {
+			continue;
+		}
+
+		Error err;
+		er.resource = ResourceLoader::_load_complete(*er.load_token.ptr(), &err);
+		if (er.resource.is_null()) {
+			if (!ResourceLoader::is_cleaning_tasks()) {
+				if (!ResourceLoader::get_abort_on_missing_resources()) {
+					ResourceLoader::notify_dependency_error(local_path, er.path, er.type);
+				} else {
+					ERR_FAIL_V_MSG(ERR_FILE_MISSING_DEPENDENCIES, vformat("Can't load dependency: '%s'.", er.path));
+				}
+			}
+			// Treat it as a broken dependency from now on.
+			er.load_token.unref();
+		}
+	}
+	return OK;
+}
+
+Ref<FileAccess> ResourceLoaderBinary::_reopen_file() const {
+	Ref<FileAccess> fa = FileAccess::open(file_path, FileAccess::READ);
+	ERR_FAIL_COND_V_MSG(fa.is_null(), Ref<FileAccess>(), vformat("Cannot reopen file '%s'.", file_path));
+
+	uint8_t header[4];
+	fa->get_buffer(header, 4);
+	if (header[0] == 'R' && header[1] == 'S' && header[2] == 'C' && header[3] == 'C') {
+		Ref<FileAccessCompressed> fac;
+		fac.instantiate();
+		Error err = fac->open_after_magic(fa);
+		ERR_FAIL_COND_V_MSG(err != OK, Ref<FileAccess>(), vformat("Cannot reopen file '%s'.", file_path));
+		fa = fac;
+	}
+
+	fa->set_big_endian(f->is_big_endian());
+	fa->real_is_double = f->real_is_double;
+	return fa;
+}
+
+Error ResourceLoaderBinary::_parse_properties(ResourceLoaderBinary &p_reader, PendingResource &r_pending) {
+	r_pending.parsed = true;
+
+	int pc = p_reader.f->get_32();
+	r_pending.properties.resize(pc);
+
+	for (int j = 0; j < pc; j++) {
+		StringName name = p_reader._get_string();
+
+		if (name == StringName()) {
+			r_pending.parse_error = ERR_FILE_CORRUPT;
+			ERR_FAIL_V(ERR_FILE_CORRUPT);
+		}
+
+		r_pending.properties[j].first = name;
+		r_pending.parse_error = p_reader.parse_variant(r_pending.properties[j].second);
+		if (r_pending.parse_error != OK) {
+			return r_pending.parse_error;
+		}
+	}
+
+	return OK;
+}
+
+void ResourceLoaderBinary::_parse_properties_task(uint32_t p_index, void *p_userdata) {
+	// Each task reads with its own file and a copy of the state needed by `parse_variant()`.
+	ResourceLoaderBinary reader;
+	reader.f = _reopen_file();
+	if (reader.f.is_null()) {
+		return; // Left to the loading thread.
+	}
+	reader.local_path = local_path;
+	reader.res_path = res_path;
+	reader.ver_format = ver_format;
+	reader.string_map = string_map;
+	reader.using_named_scene_ids = using_named_scene_ids;
+	reader.external_resources = external_resources;
+	reader.internal_resources = internal_resources;
+	reader.internal_index_cache = internal_index_cache;
+	reader.remaps = remaps;
+	reader.cache_mode_for_external = cache_mode_for_external;
+
+	for (uint32_t i = next_pending_resource.postincrement(); i < pending_resources.size(); i = next_pending_resource.postincrement()) {
+		PendingResource &pending = pending_resources[i];
+		reader.f->seek(pending.properties_offset);
+		_parse_properties(reader, pending);
+	}
+}
+
+Error ResourceLoaderBinary::_set_properties(PendingResource &p_pending) {
+	Ref<Resource> res = p_pending.resource;
+
+	//set properties
+
+	Dictionary missing_resource_properties;
+
+	for (Pair<StringName, Variant> &property : p_pending.properties) {
+		const StringName &name = property.first;
+		Variant &value = property.second;
+
+		bool set_valid = true;
+		if (value.get_type() == Variant::OBJECT && p_pending.missing_resource == nullptr && ResourceLoader::is_creating_missing_resources_if_class_unavailable_enabled()) {
+			// If the property being set is a missing resource (and the parent is not),
+			// then setting it will most likely not work.
+			// Instead, save it as metadata.
+
+			Ref<MissingResource> mr = value;
+			if (mr.is_valid()) {
+				missing_resource_properties[name] = mr;
+				set_valid = false;
+			}
+		}
+
+		if (value.get_type() == Variant::ARRAY) {
+			Array set_array = value;
+			bool is_get_valid = false;
+			Variant get_value = res->get(name, &is_get_valid);
+			if (is_get_valid && get_value.get_type() == Variant::ARRAY) {
+				Array get_array = get_value;
+				if (!set_array.is_same_typed(get_array)) {
+					value = Array(set_array, get_array.get_typed_builtin(), get_array.get_typed_class_name(), get_array.get_typed_script());
+				}
+			}
+		}
+
+		if (value.get_type() == Variant::DICTIONARY) {
+			Dictionary set_dict = value;
+			bool is_get_valid = false;
+			Variant get_value = res->get(name, &is_get_valid);
+			if (is_get_valid && get_value.get_type() == Variant::DICTIONARY) {
+				Dictionary get_dict = get_value;
+				if (!set_dict.is_same_typed(get_dict)) {
+					value = Dictionary(set_dict, get_dict.get_typed_key_builtin(), get_dict.get_typed_key_class_name(), get_dict.get_typed_key_script(),
+							get_dict.get_typed_value_builtin(), get_dict.get_typed_value_class_name(), get_dict.get_typed_value_script());
+				}
+			}
+		}
+
+		if (set_valid) {
+			res->set(name, value);
+		}
+	}
+
+	// Release parsed values as soon as they are set.
+	p_pending.properties.clear();
+
+	if (p_pending.missing_resource) {
+		p_pending.missing_resource->set_recording_properties(false);
+	}
+
+	if (!missing_resource_properties.is_empty()) {
+		res->set_meta(META_MISSING_RESOURCES, missing_resource_properties);
+	}
+
+	return OK;
+}
+
 void ResourceLoaderBinary::set_translation_remapped(bool p_remapped) {
 	translation_remapped = p_remapped;
 }
@@ -1242,6 +1383,7 @@ Ref<Resource> ResourceFormatLoaderBinary::load(const String &p_path, const Strin
 	String path = !p_original_path.is_empty() ? p_original_path : p_path;
 	loader.local_path = ProjectSettings::get_singleton()->localize_path(path);
 	loader.res_path = loader.local_path;
+	loader.file_path = p_path;
 	loader.open(f);
 
 	err = loader.load();
@@ -2345,6 +2487,7 @@ Error ResourceFormatSaverBinaryInstance::save(const String &p_path, const Ref<Re
 
 	//now actually save the resources
 	for (const ResourceData &rd : resources) {
+		ResourceSaver::set_thread_save_progress(ofs_table.size() / float(resources.size()));
 		ofs_table.push_back(f->get_position());
 		save_unicode_string(f, rd.type);
 		f->store_32(uint32_t(rd.properties.size()));
@@ -35,6 +35,10 @@
 #include "core/io/file_access.h"
 #include "core/io/resource_loader.h"
 #include "core/io/resource_saver.h"
+#include "core/templates/local_vector.h"
+#include "core/templates/pair.h"
+
+class MissingResource;
 
 class ResourceLoaderBinary {
 	bool translation_remapped = false;
@@ -45,6 +49,7 @@ class ResourceLoaderBinary {
 	uint32_t ver_format = 0;
 
 	Ref<FileAccess> f;
+	String file_path; // Path `f` was opened from, to read internal resources from other threads.
 
 	uint64_t importmd_ofs = 0;
 
@@ -62,6 +67,7 @@ class ResourceLoaderBinary {
 		String type;
 		ResourceUID::ID uid = ResourceUID::INVALID_ID;
 		Ref<ResourceLoader::LoadToken> load_token;
+		Ref<Resource> resource; // Set once loaded, before parsing internal resources in parallel.
 	};
 
 	bool using_named_scene_ids = false;
@@ -79,6 +85,29 @@ class ResourceLoaderBinary {
 	Vector<IntResource> internal_resources;
 	HashMap<String, Ref<Resource>> internal_index_cache;
 
+	// Internal resources are instantiated first, so their properties can be parsed in any order.
+	struct PendingResource {
+		Ref<Resource> resource;
+		MissingResource *missing_resource = nullptr;
+		bool main = false;
+		uint64_t properties_offset = 0;
+		bool parsed = false;
+		Error parse_error = OK;
+		LocalVector<Pair<StringName, Variant>> properties;
+	};
+
+	// Minimum amount of internal resources to parse them on multiple threads.
+	static constexpr uint32_t PARALLEL_PARSE_THRESHOLD = 8;
+
+	LocalVector<PendingResource> pending_resources;
+	SafeNumeric<uint32_t> next_pending_resource;
+
+	Error _resolve_external_resources();
+	Ref<FileAccess> _reopen_file() const;
+	static Error _parse_properties(ResourceLoaderBinary &p_reader, PendingResource &r_pending);
+	void _parse_properties_task(uint32_t p_index, void *p_userdata);
+	Error _set_properties(PendingResource &p_pending);
+
 	String get_unicode_string();
 	void _advance_padding(uint32_t p_len);
 
@@ -34,8 +34,11 @@
 
 #include "core/config/project_settings.h"
 #include "core/core_bind.h"
+#include "core/debugger/trace_profiler.h"
+#include "core/io/config_file.h"
 #include "core/io/dir_access.h"
 #include "core/io/file_access.h"
+#include "core/io/file_access_pack.h"
 #include "core/io/resource_importer.h"
 #include "core/object/script_language.h"
 #include "core/os/condition_variable.h"
@@ -290,19 +293,25 @@ ResourceLoader::LoadToken::~LoadToken() {
 
 Ref<Resource> ResourceLoader::_load(const String &p_path, const String &p_original_path, const String &p_type_hint, ResourceFormatLoader::CacheMode p_cache_mode, Error *r_error, bool p_use_sub_threads, float *r_progress) {
 	const String &original_path = p_original_path.is_empty() ? p_path : p_original_path;
+	TRACE_ZONE_DETAIL("ResourceLoader::_load", original_path);
 	load_nesting++;
+	bool is_remapped_load = false;
 	if (load_paths_stack.size()) {
 		MutexLock thread_load_lock(thread_load_mutex);
 		const String &parent_task_path = load_paths_stack.get(load_paths_stack.size() - 1);
 		HashMap<String, ThreadLoadTask>::Iterator E = thread_load_tasks.find(parent_task_path);
 		// Avoid double-tracking, for progress reporting, resources that boil down to a remapped path containing the real payload (e.g., imported resources).
-		bool is_remapped_load = original_path == parent_task_path;
+		is_remapped_load = original_path == parent_task_path;
 		if (E && !is_remapped_load) {
 			E->value.sub_tasks.insert(p_original_path);
 		}
 	}
 	load_paths_stack.push_back(original_path);
 
+	if (load_order_recording.is_set()) {
+		_record_load_start(p_path);
+	}
+
 	print_verbose(vformat("Loading resource: %s", p_path));
 
 	// Try all loaders and pick the first match for the type hint
@@ -324,6 +333,9 @@ Ref<Resource> ResourceLoader::_load(const String &p_path, const String &p_origin
 	load_nesting--;
 
 	if (res.is_valid()) {
+		if (load_order_recording.is_set() && !is_remapped_load) {
+			_record_load_end(original_path);
+		}
 		return res;
 	} else {
 		print_verbose(vformat("Failed loading resource: %s", p_path));
@@ -1416,6 +1428,89 @@ void ResourceLoader::clear_thread_load_tasks() {
 	cleaning_tasks = false;
 }
 
+#define PREFETCH_MANIFEST_PATH "user://main_scene_prefetch.cfg"
+
+void ResourceLoader::_record_load_start(const String &p_path) {
+	MutexLock lock(load_order_mutex);
+	if (load_order_record && !load_order_record->seen_files.has(p_path)) {
+		load_order_record->seen_files.insert(p_path);
+		load_order_record->files.push_back(p_path);
+	}
+}
+
+void ResourceLoader::_record_load_end(const String &p_original_path) {
+	MutexLock lock(load_order_mutex);
+	if (load_order_record && p_original_path != load_order_record->scene_path && !load_order_record->seen_resources.has(p_original_path)) {
+		load_order_record->seen_resources.insert(p_original_path);
+		load_order_record->resources.push_back(p_original_path);
+	}
+}
+
+// Starts loading everything the scene needed last time, all at once instead of
+// as each dependency is discovered, and records what it needs this time.
+void ResourceLoader::prefetch_dependencies_begin(const String &p_path) {
+	ERR_FAIL_COND_MSG(load_order_record, "Dependencies are already being prefetched.");
+
+	LoadOrderRecord *record = memnew(LoadOrderRecord);
+	record->scene_path = p_path;
+
+	Ref<ConfigFile> manifest;
+	manifest.instantiate();
+	if (manifest->load(PREFETCH_MANIFEST_PATH) == OK && manifest->get_value("prefetch", "scene", String()) == p_path) {
+		record->previous_files = manifest->get_value("prefetch", "files", PackedStringArray());
+		record->previous_resources = manifest->get_value("prefetch", "resources", PackedStringArray());
+
+		// Have the storage start reading in the files, then parse them on worker threads.
+		if (PackedData::get_singleton() && !PackedData::get_singleton()->is_disabled()) {
+			for (const String &file : record->previous_files) {
+				PackedData::get_singleton()->prefetch(file);
+			}
+		}
+		for (const String &resource : record->previous_resources) {
+			if (!ResourceCache::has(resource) && load_threaded_request(resource, "", true) == OK) {
+				record->prefetched.push_back(resource);
+			}
+		}
+		print_verbose(vformat("Prefetching %d dependencies of %s.", record->prefetched.size(), p_path));
+	}
+
+	MutexLock lock(load_order_mutex);
+	load_order_record = record;
+	load_order_recording.set();
+}
+
+void ResourceLoader::prefetch_dependencies_end() {
+	LoadOrderRecord *record = nullptr;
+	{
+		MutexLock lock(load_order_mutex);
+		record = load_order_record;
+		load_order_record = nullptr;
+		load_order_recording.clear();
+	}
+	ERR_FAIL_NULL_MSG(record, "Dependencies are not being prefetched.");
+
+	// Release the requests. Anything the scene no longer uses may still be loading.
+	for (const String &resource : record->prefetched) {
+		load_threaded_get(resource);
+	}
+
+	const PackedStringArray files(record->files);
+	const PackedStringArray resources(record->resources);
+	if (!resources.is_empty() && (files != record->previous_files || resources != record->previous_resources)) {
+		Ref<ConfigFile> manifest;
+		manifest.instantiate();
+		manifest->set_value("prefetch", "scene", record->scene_path);
+		manifest->set_value("prefetch", "files", files);
+		manifest->set_value("prefetch", "resources", resources);
+		Error err = manifest->save(PREFETCH_MANIFEST_PATH);
+		if (err != OK) {
+			WARN_PRINT(vformat("Could not save the dependency prefetch manifest to '%s'.", PREFETCH_MANIFEST_PATH));
+		}
+	}
+
+	memdelete(record);
+}
+
 void ResourceLoader::set_load_callback(ResourceLoadedCallback p_callback) {
 	_loaded_callback = p_callback;
 }
@@ -1578,6 +1673,10 @@ bool ResourceLoader::cleaning_tasks = false;
 
 HashMap<String, ResourceLoader::LoadToken *> ResourceLoader::user_load_tokens;
 
+BinaryMutex ResourceLoader::load_order_mutex;
+SafeFlag ResourceLoader::load_order_recording;
+ResourceLoader::LoadOrderRecord *ResourceLoader::load_order_record = nullptr;
+
 SelfList<Resource>::List ResourceLoader::remapped_list;
 HashMap<String, Vector<String>> ResourceLoader::translation_remaps;
 
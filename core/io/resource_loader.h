@@ -225,6 +225,25 @@ private:
 
 	static String _validate_local_path(const String &p_path);
 
+	// Resources loaded while the main scene loads, recorded to be prefetched the next time.
+	struct LoadOrderRecord {
+		String scene_path;
+		Vector<String> files; // Files actually read, in the order loading started.
+		Vector<String> resources; // Resources to request, leaves of the dependency graph first.
+		HashSet<String> seen_files;
+		HashSet<String> seen_resources;
+		Vector<String> prefetched; // Requested from the previous manifest, released when done.
+		PackedStringArray previous_files;
+		PackedStringArray previous_resources;
+	};
+
+	static BinaryMutex load_order_mutex;
+	static SafeFlag load_order_recording;
+	static LoadOrderRecord *load_order_record;
+
+	static void _record_load_start(const String &p_path);
+	static void _record_load_end(const String &p_original_path);
+
 public:
 	static Error load_threaded_request(const String &p_path, const String &p_type_hint = "", bool p_use_sub_threads = false, ResourceFormatLoader::CacheMode p_cache_mode = ResourceFormatLoader::CACHE_MODE_REUSE);
 	static ThreadLoadStatus load_threaded_get_status(const String &p_path, float *r_progress = nullptr);
@@ -296,6 +315,9 @@ public:
 
 	static void clear_thread_load_tasks();
 
+	static void prefetch_dependencies_begin(const String &p_path);
+	static void prefetch_dependencies_end();
+
 	static void set_load_callback(ResourceLoadedCallback p_callback);
 	static ResourceLoaderImport import;
 
@@ -34,6 +34,7 @@
 #include "core/config/project_settings.h"
 #include "core/io/file_access.h"
 #include "core/io/resource_loader.h"
+#include "core/object/callable_method_pointer.h"
 #include "core/object/script_language.h"
 
 Ref<ResourceFormatSaver> ResourceSaver::saver[MAX_SAVERS];
@@ -43,6 +44,10 @@ bool ResourceSaver::timestamp_on_save = false;
 ResourceSavedCallback ResourceSaver::save_callback = nullptr;
 ResourceSaverGetResourceIDForPath ResourceSaver::save_get_id_for_path = nullptr;
 
+Mutex ResourceSaver::thread_save_mutex;
+HashMap<String, ResourceSaver::ThreadSaveTask *> ResourceSaver::thread_save_tasks;
+thread_local ResourceSaver::ThreadSaveTask *ResourceSaver::current_thread_save_task = nullptr;
+
 Error ResourceFormatSaver::save(const Ref<Resource> &p_resource, const String &p_path, uint32_t p_flags) {
 	Error err = ERR_METHOD_NOT_FOUND;
 	GDVIRTUAL_CALL(_save, p_resource, p_path, p_flags, err);
@@ -100,6 +105,10 @@ void ResourceFormatSaver::_bind_methods() {
 }
 
 Error ResourceSaver::save(const Ref<Resource> &p_resource, const String &p_path, uint32_t p_flags) {
+	return _save(p_resource, p_path, p_flags, true);
+}
+
+Error ResourceSaver::_save(const Ref<Resource> &p_resource, const String &p_path, uint32_t p_flags, bool p_notify) {
 	ERR_FAIL_COND_V_MSG(p_resource.is_null(), ERR_INVALID_PARAMETER, vformat("Can't save empty resource to path '%s'.", p_path));
 	String path = p_path;
 	if (path.is_empty()) {
@@ -130,21 +139,23 @@ Error ResourceSaver::save(const Ref<Resource> &p_resource, const String &p_path,
 		err = saver[i]->save(p_resource, path, p_flags);
 
 		if (err == OK) {
+			if (p_notify) {
 #ifdef TOOLS_ENABLED
 
-			((Resource *)p_resource.ptr())->set_edited(false);
-			if (timestamp_on_save) {
-				uint64_t mt = FileAccess::get_modified_time(path);
+				((Resource *)p_resource.ptr())->set_edited(false);
+				if (timestamp_on_save) {
+					uint64_t mt = FileAccess::get_modified_time(path);
 
-				((Resource *)p_resource.ptr())->set_last_modified_time(mt);
-			}
+					((Resource *)p_resource.ptr())->set_last_modified_time(mt);
+				}
 #endif
+			}
 
 			if (p_flags & FLAG_CHANGE_PATH) {
 				p_resource->set_path(old_path);
 			}
 
-			if (save_callback && path.begins_with("res://")) {
+			if (p_notify && save_callback && path.begins_with("res://")) {
 				save_callback(p_resource, path);
 			}
 
@@ -155,6 +166,190 @@ Error ResourceSaver::save(const Ref<Resource> &p_resource, const String &p_path,
 	return err;
 }
 
+Error ResourceSaver::save_threaded(const Ref<Resource> &p_resource, const String &p_path, uint32_t p_flags) {
+	ERR_FAIL_COND_V_MSG(p_resource.is_null(), ERR_INVALID_PARAMETER, vformat("Can't save empty resource to path '%s'.", p_path));
+	String path = p_path;
+	if (path.is_empty()) {
+		path = p_resource->get_path();
+	}
+	ERR_FAIL_COND_V_MSG(path.is_empty(), ERR_INVALID_PARAMETER, "Can't save resource to empty path. Provide non-empty path or a Resource with non-empty resource_path.");
+	const String local_path = ProjectSettings::get_singleton()->localize_path(path);
+
+	ThreadSaveTask *previous_task = nullptr;
+	{
+		MutexLock lock(thread_save_mutex);
+		ThreadSaveTask **existing = thread_save_tasks.getptr(local_path);
+		if (existing) {
+			ERR_FAIL_COND_V_MSG((*existing)->status == THREAD_SAVE_IN_PROGRESS, ERR_BUSY, vformat("Resource is already being saved to '%s'.", local_path));
+			previous_task = *existing;
+			thread_save_tasks.erase(local_path);
+		}
+	}
+	if (previous_task) {
+		_await_thread_save_task(previous_task);
+		memdelete(previous_task);
+	}
+
+	// Built-in sub-resources are copied too, packed arrays are shared until written to, so this is cheap
+	// compared to serializing. External resources are saved as references, so they don't need a copy.
+	HashMap<Ref<Resource>, Ref<Resource>> remap_cache;
+	Ref<Resource> snapshot = p_resource->duplicate_deep_remapped(RESOURCE_DEEP_DUPLICATE_INTERNAL, remap_cache);
+	ERR_FAIL_COND_V_MSG(snapshot.is_null(), ERR_CANT_CREATE, vformat("Can't copy resource to save it to '%s'.", local_path));
+
+	ThreadSaveTask *task = memnew(ThreadSaveTask);
+	task->resource = p_resource;
+	task->snapshot = snapshot;
+	task->path = path;
+	// The paths are changed on the original once saved, the copy must not take over the paths of the original.
+	task->flags = p_flags & ~(FLAG_CHANGE_PATH | FLAG_REPLACE_SUBRESOURCE_PATHS);
+	task->finished_flags = p_flags;
+	for (const KeyValue<Ref<Resource>, Ref<Resource>> &E : remap_cache) {
+		if (E.key == p_resource) {
+			continue;
+		}
+		// Keep the IDs, so they don't change on every save.
+		E.value->set_scene_unique_id(E.key->get_scene_unique_id());
+		task->subresources.push_back(E.key);
+		task->subresource_copies.push_back(E.value);
+	}
+
+	MutexLock lock(thread_save_mutex);
+	thread_save_tasks[local_path] = task;
+	task->task_id = WorkerThreadPool::get_singleton()->add_native_task(&ResourceSaver::_thread_save_function, task, false, vformat("Save resource %s", local_path));
+	return OK;
+}
+
+void ResourceSaver::_thread_save_function(void *p_userdata) {
+	ThreadSaveTask *task = (ThreadSaveTask *)p_userdata;
+
+	current_thread_save_task = task;
+	FileAccess::set_thread_backup_save(true);
+	Error err = _save(task->snapshot, task->path, task->flags, false);
+	FileAccess::set_thread_backup_save(false);
+	current_thread_save_task = nullptr;
+
+	if (err == OK) {
+		// Savers give an ID to the sub-resources that had none, they are passed to the originals.
+		Array subresources;
+		PackedStringArray subresource_ids;
+		for (uint32_t i = 0; i < task->subresources.size(); i++) {
+			subresources.push_back(task->subresources[i]);
+			subresource_ids.push_back(task->subresource_copies[i]->get_scene_unique_id());
+		}
+		callable_mp_static(&ResourceSaver::_thread_save_finished).call_deferred(task->resource, task->path, task->finished_flags, subresources, subresource_ids);
+	}
+
+	// Release the copy here, rather than on the thread collecting the result.
+	task->subresource_copies.clear();
+	task->snapshot.unref();
+
+	MutexLock lock(thread_save_mutex);
+	task->error = err;
+	task->status = err == OK ? THREAD_SAVE_SAVED : THREAD_SAVE_FAILED;
+	task->progress = 1.0f;
+}
+
+void ResourceSaver::_thread_save_finished(const Ref<Resource> &p_resource, const String &p_path, uint32_t p_flags, const Array &p_subresources, const PackedStringArray &p_subresource_ids) {
+	const String local_path = ProjectSettings::get_singleton()->localize_path(p_path);
+	// Same as the savers, only paths inside the project are taken over.
+	const bool takeover_paths = (p_flags & FLAG_REPLACE_SUBRESOURCE_PATHS) && local_path.begins_with("res://");
+
+	for (int i = 0; i < p_subresources.size(); i++) {
+		Ref<Resource> subresource = p_subresources[i];
+		const String &id = p_subresource_ids[i];
+		if (id.is_empty()) {
+			continue; // Not written by the saver.
+		}
+		subresource->set_scene_unique_id(id);
+		if (takeover_paths && subresource->is_built_in()) {
+			subresource->set_path(local_path + "::" + id, true);
+		}
+#ifdef TOOLS_ENABLED
+		subresource->set_edited(false);
+#endif
+	}
+
+	if (p_flags & FLAG_CHANGE_PATH) {
+		p_resource->set_path(local_path);
+	}
+
+#ifdef TOOLS_ENABLED
+	p_resource->set_edited(false);
+	if (timestamp_on_save) {
+		p_resource->set_last_modified_time(FileAccess::get_modified_time(p_path));
+	}
+#endif
+	if (save_callback && p_path.begins_with("res://")) {
+		save_callback(p_resource, p_path);
+	}
+}
+
+void ResourceSaver::_await_thread_save_task(ThreadSaveTask *p_task) {
+	if (!p_task->awaited) {
+		WorkerThreadPool::get_singleton()->wait_for_task_completion(p_task->task_id);
+		p_task->awaited = true;
+	}
+}
+
+ResourceSaver::ThreadSaveStatus ResourceSaver::save_threaded_get_status(const String &p_path, float *r_progress) {
+	const String local_path = ProjectSettings::get_singleton()->localize_path(p_path);
+
+	MutexLock lock(thread_save_mutex);
+	ThreadSaveTask **task = thread_save_tasks.getptr(local_path);
+	if (!task) {
+		if (r_progress) {
+			*r_progress = 0.0f;
+		}
+		return THREAD_SAVE_INVALID_RESOURCE;
+	}
+
+	if (r_progress) {
+		*r_progress = (*task)->progress;
+	}
+	return (*task)->status;
+}
+
+Error ResourceSaver::save_threaded_wait(const String &p_path) {
+	const String local_path = ProjectSettings::get_singleton()->localize_path(p_path);
+
+	ThreadSaveTask *task = nullptr;
+	{
+		MutexLock lock(thread_save_mutex);
+		ThreadSaveTask **existing = thread_save_tasks.getptr(local_path);
+		ERR_FAIL_NULL_V_MSG(existing, ERR_DOES_NOT_EXIST, vformat("No resource is being saved to '%s'. Call save_threaded() first.", local_path));
+		task = *existing;
+		thread_save_tasks.erase(local_path);
+	}
+
+	_await_thread_save_task(task);
+	const Error err = task->error;
+	memdelete(task);
+	return err;
+}
+
+void ResourceSaver::set_thread_save_progress(float p_progress) {
+	if (!current_thread_save_task) {
+		return;
+	}
+
+	MutexLock lock(thread_save_mutex);
+	current_thread_save_task->progress = CLAMP(p_progress, 0.0f, 1.0f);
+}
+
+void ResourceSaver::clear_thread_save_tasks() {
+	HashMap<String, ThreadSaveTask *> tasks;
+	{
+		MutexLock lock(thread_save_mutex);
+		SWAP(tasks, thread_save_tasks);
+	}
+
+	// Tasks need the lock to finish.
+	for (KeyValue<String, ThreadSaveTask *> &E : tasks) {
+		_await_thread_save_task(E.value);
+		memdelete(E.value);
+	}
+}
+
 Error ResourceSaver::set_uid(const String &p_path, ResourceUID::ID p_uid) {
 	String path = p_path;
 
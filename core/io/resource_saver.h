@@ -34,6 +34,7 @@
 
 #include "core/io/resource.h"
 #include "core/object/gdvirtual.gen.inc"
+#include "core/object/worker_thread_pool.h"
 
 class ResourceFormatSaver : public RefCounted {
 	GDCLASS(ResourceFormatSaver, RefCounted);
@@ -85,7 +86,48 @@ public:
 		FLAG_REPLACE_SUBRESOURCE_PATHS = 64,
 	};
 
+	enum ThreadSaveStatus {
+		THREAD_SAVE_INVALID_RESOURCE,
+		THREAD_SAVE_IN_PROGRESS,
+		THREAD_SAVE_FAILED,
+		THREAD_SAVE_SAVED,
+	};
+
+private:
+	struct ThreadSaveTask {
+		WorkerThreadPool::TaskID task_id = 0;
+		Ref<Resource> resource; // The one passed to `save_threaded()`.
+		Ref<Resource> snapshot; // What is actually saved, so the resource can keep being modified.
+		LocalVector<Ref<Resource>> subresources; // The built-in sub-resources copied into the snapshot.
+		LocalVector<Ref<Resource>> subresource_copies; // Their copy, at the same index.
+		String path;
+		uint32_t flags = 0; // Passed to the saver.
+		uint32_t finished_flags = 0; // As passed to `save_threaded()`, applied to the original once saved.
+		ThreadSaveStatus status = THREAD_SAVE_IN_PROGRESS;
+		float progress = 0.0f;
+		Error error = OK;
+		bool awaited = false;
+	};
+
+	static Mutex thread_save_mutex;
+	static HashMap<String, ThreadSaveTask *> thread_save_tasks;
+	static thread_local ThreadSaveTask *current_thread_save_task;
+
+	static Error _save(const Ref<Resource> &p_resource, const String &p_path, uint32_t p_flags, bool p_notify);
+	static void _thread_save_function(void *p_userdata);
+	static void _thread_save_finished(const Ref<Resource> &p_resource, const String &p_path, uint32_t p_flags, const Array &p_subresources, const PackedStringArray &p_subresource_ids);
+	static void _await_thread_save_task(ThreadSaveTask *p_task);
+
+public:
 	static Error save(const Ref<Resource> &p_resource, const String &p_path = "", uint32_t p_flags = (uint32_t)FLAG_NONE);
+
+	// Saves a copy of the resource on a worker thread, so it can keep being used meanwhile.
+	// Files are written to a temporary file first, then renamed over the previous one.
+	static Error save_threaded(const Ref<Resource> &p_resource, const String &p_path = "", uint32_t p_flags = (uint32_t)FLAG_NONE);
+	static ThreadSaveStatus save_threaded_get_status(const String &p_path, float *r_progress = nullptr);
+	static Error save_threaded_wait(const String &p_path);
+	static void set_thread_save_progress(float p_progress); // For savers, to report how far they are.
+	static void clear_thread_save_tasks();
 	static void get_recognized_extensions(const Ref<Resource> &p_resource, List<String> *p_extensions);
 	static void add_resource_format_saver(Ref<ResourceFormatSaver> p_format_saver, bool p_at_front = false);
 	static void remove_resource_format_saver(Ref<ResourceFormatSaver> p_format_saver);
@@ -55,6 +55,7 @@
 #include "bvh_tree.h"
 
 #include "core/math/geometry_3d.h"
+#include "core/object/worker_thread_pool.h"
 #include "core/os/mutex.h"
 
 #define BVHTREE_CLASS BVH_Tree<T, NUM_TREES, 2, MAX_ITEMS, USER_PAIR_TEST_FUNCTION, USER_CULL_TEST_FUNCTION, USE_PAIRS, BOUNDS, POINT>
@@ -91,6 +92,13 @@ public:
 		tree.params_set_pairing_expansion(p_value);
 	}
 
+	// When many items changed since the last update, their pairing queries can be spread across
+	// the WorkerThreadPool. Pair and unpair callbacks are still sent from the calling thread, in the same order.
+	void params_set_threaded_pairing(bool p_enable) {
+		BVH_LOCKED_FUNCTION
+		_threaded_pairing = p_enable;
+	}
+
 	void set_pair_callback(PairCallback p_callback, void *p_userdata) {
 		BVH_LOCKED_FUNCTION
 		pair_callback = p_callback;
@@ -445,26 +453,44 @@ private:
 		params.result_array = nullptr;
 		params.subindex_array = nullptr;
 
-		for (const BVHHandle &h : changed_items) {
+		// The queries only depend on the tree, not on the pairs, so they can all be done up front.
+		// Results are still processed in the changed items order, which keeps the callbacks deterministic.
+		const bool threaded = _threaded_pairing && changed_items.size() >= THREADED_PAIRING_MIN_ITEMS;
+		if (threaded) {
+			if (_threaded_pairing_hits.size() < changed_items.size()) {
+				_threaded_pairing_hits.resize(changed_items.size());
+			}
+			WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &BVH_Manager::_cull_pairing_hits, nullptr, changed_items.size(), -1, true, SNAME("BVHPairing"));
+			WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+		}
+
+		for (uint32_t i = 0; i < changed_items.size(); i++) {
+			const BVHHandle &h = changed_items[i];
+
 			// use the expanded aabb for pairing
 			const BOUNDS &expanded_aabb = tree._pairs[h.id()].expanded_aabb;
 			BVHABB_CLASS abb;
 			abb.from(expanded_aabb);
 
-			tree.item_fill_cullparams(h, params);
-
 			// find all the existing paired aabbs that are no longer
 			// paired, and send callbacks
 			_find_leavers(h, abb, p_full_check);
 
 			uint32_t changed_item_ref_id = h.id();
 
-			params.abb = abb;
+			const LocalVector<uint32_t> *hits = nullptr;
+			if (threaded) {
+				hits = &_threaded_pairing_hits[i];
+			} else {
+				tree.item_fill_cullparams(h, params);
+				params.abb = abb;
 
-			params.result_count_overall = 0; // might not be needed
-			tree.cull_aabb(params, false);
+				params.result_count_overall = 0; // might not be needed
+				tree.cull_aabb(params, false);
+				hits = &tree._cull_hits;
+			}
 
-			for (const uint32_t ref_id : tree._cull_hits) {
+			for (const uint32_t ref_id : *hits) {
 				// don't collide against ourself
 				if (ref_id == changed_item_ref_id) {
 					continue;
@@ -481,6 +507,20 @@ private:
 		_reset();
 	}
 
+	void _cull_pairing_hits(uint32_t p_index, void *p_userdata) {
+		const BVHHandle &h = changed_items[p_index];
+
+		typename BVHTREE_CLASS::CullParams params;
+		params.result_count_overall = 0;
+		params.result_max = INT_MAX;
+		params.result_array = nullptr;
+		params.subindex_array = nullptr;
+		tree.item_fill_cullparams(h, params);
+		params.abb.from(tree._pairs[h.id()].expanded_aabb);
+
+		tree.cull_aabb_hits(params, _threaded_pairing_hits[p_index]);
+	}
+
 public:
 	void item_get_AABB(BVHHandle p_handle, BOUNDS &r_aabb) {
 		DEV_ASSERT(!p_handle.is_invalid());
@@ -774,6 +814,10 @@ private:
 	LocalVector<BVHHandle> changed_items;
 	uint32_t _tick = 1; // Start from 1 so items with 0 indicate never updated.
 
+	static constexpr uint32_t THREADED_PAIRING_MIN_ITEMS = 64; // Below this, going wide costs more than it saves.
+	bool _threaded_pairing = false;
+	LocalVector<LocalVector<uint32_t>> _threaded_pairing_hits; // Indexed like changed_items.
+
 	class BVHLockedFunction {
 	public:
 		BVHLockedFunction(Mutex *p_mutex, bool p_thread_safe) {
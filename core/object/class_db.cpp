@@ -634,6 +634,22 @@ Object *ClassDB::instantiate(const StringName &p_class) {
 	return _instantiate_internal(p_class);
 }
 
+// Returns the function `instantiate()` would end up calling for native classes, so callers
+// creating many objects of the same class can skip the lookup. Returns null for other classes.
+ClassDB::CreationFunc ClassDB::get_native_creation_func(const StringName &p_class) {
+	Locker::Lock lock(Locker::STATE_READ);
+	ClassInfo *ti = classes.getptr(p_class);
+	if (!ti || ti->disabled || ti->gdextension || ti->is_runtime) {
+		return nullptr;
+	}
+#ifdef TOOLS_ENABLED
+	if (ti->api == API_EDITOR || ti->api == API_EDITOR_EXTENSION) {
+		return nullptr;
+	}
+#endif
+	return ti->creation_func;
+}
+
 Object *ClassDB::instantiate_no_placeholders(const StringName &p_class) {
 	return _instantiate_internal(p_class, true);
 }
@@ -1771,6 +1787,21 @@ StringName ClassDB::get_property_setter(const StringName &p_class, const StringN
 	return StringName();
 }
 
+const ClassDB::PropertySetGet *ClassDB::get_property_setget(const StringName &p_class, const StringName &p_property) {
+	ClassInfo *type = classes.getptr(p_class);
+	ClassInfo *check = type;
+	while (check) {
+		const PropertySetGet *psg = check->property_setget.getptr(p_property);
+		if (psg) {
+			return psg;
+		}
+
+		check = check->inherits_ptr;
+	}
+
+	return nullptr;
+}
+
 StringName ClassDB::get_property_getter(const StringName &p_class, const StringName &p_property) {
 	ClassInfo *type = classes.getptr(p_class);
 	ClassInfo *check = type;
@@ -35,6 +35,7 @@
 #include "core/config/project_settings.h"
 #include "core/object/class_db.h"
 #include "core/object/script_language.h"
+#include "core/os/thread.h"
 
 #include <cstdio>
 
@@ -60,13 +61,96 @@
 		mutex.unlock();                           \
 	}
 
+thread_local CallQueue::ThreadStagingHolder CallQueue::thread_staging;
+
+CallQueue::ThreadStagingHolder::~ThreadStagingHolder() {
+	if (staging) {
+		staging->thread_exited.set();
+		_release_thread_staging(staging);
+	}
+}
+
+void CallQueue::_release_thread_staging(ThreadStaging *p_staging) {
+	if (p_staging->refcount.unref()) {
+		memdelete(p_staging->queue);
+		memdelete(p_staging);
+	}
+}
+
+CallQueue *CallQueue::_get_thread_staging_queue() {
+	if (!thread_staging_enabled || this == MessageQueue::thread_singleton || Thread::is_main_thread()) {
+		return nullptr;
+	}
+
+	ThreadStaging *staging = thread_staging.staging;
+	if (likely(staging && staging->owner == this && !staging->owner_deleted.is_set())) {
+		return staging->queue;
+	}
+
+	if (staging) {
+		// Staging for another queue, let it take the remaining messages and drop it.
+		staging->thread_exited.set();
+		_release_thread_staging(staging);
+	}
+
+	staging = memnew(ThreadStaging);
+	staging->owner = this;
+	staging->queue = memnew(CallQueue(allocator, max_pages, error_text));
+	staging->queue->pages_used_counter = &total_pages_used;
+	staging->refcount.init(2);
+	{
+		MutexLock lock(thread_staging_mutex);
+		thread_stagings.push_back(staging);
+	}
+	thread_staging.staging = staging;
+	return staging->queue;
+}
+
+bool CallQueue::_splice_thread_staging() {
+	MutexLock lock(thread_staging_mutex);
+	bool spliced = false;
+
+	for (uint32_t i = 0; i < thread_stagings.size(); i++) {
+		ThreadStaging *staging = thread_stagings[i];
+		// Checked before splicing, so the thread can't push anything after it.
+		bool exited = staging->thread_exited.is_set();
+
+		CallQueue *queue = staging->queue;
+		queue->mutex.lock();
+		for (uint32_t j = 0; j < queue->pages_used; j++) {
+			if (queue->page_bytes[j] == 0) {
+				continue;
+			}
+			_ensure_first_page();
+			if (page_bytes[pages_used - 1] != 0) {
+				_add_page();
+			}
+			// Trade the staged page for an empty one, the messages themselves are not moved.
+			SWAP(pages[pages_used - 1], queue->pages[j]);
+			page_bytes[pages_used - 1] = queue->page_bytes[j];
+			queue->page_bytes[j] = 0;
+			spliced = true;
+		}
+		queue->_set_pages_used(queue->pages.is_empty() ? 0 : 1);
+		queue->mutex.unlock();
+
+		if (exited) {
+			thread_stagings.remove_at_unordered(i);
+			i--;
+			_release_thread_staging(staging);
+		}
+	}
+
+	return spliced;
+}
+
 void CallQueue::_add_page() {
 	if (pages_used == page_bytes.size()) {
 		pages.push_back(allocator->alloc());
 		page_bytes.push_back(0);
 	}
 	page_bytes[pages_used] = 0;
-	pages_used++;
+	_set_pages_used(pages_used + 1);
 }
 
 Error CallQueue::push_callp(ObjectID p_id, const StringName &p_method, const Variant **p_args, int p_argcount, bool p_show_error) {
@@ -90,12 +174,17 @@ Error CallQueue::push_callablep(const Callable &p_callable, const Variant **p_ar
 
 	ERR_FAIL_COND_V_MSG(room_needed > uint32_t(PAGE_SIZE_BYTES), ERR_INVALID_PARAMETER, "Message is too large to fit on a page (" + itos(PAGE_SIZE_BYTES) + " bytes), consider passing less arguments.");
 
+	CallQueue *staging_queue = _get_thread_staging_queue();
+	if (staging_queue) {
+		return staging_queue->push_callablep(p_callable, p_args, p_argcount, p_show_error);
+	}
+
 	LOCK_MUTEX;
 
 	_ensure_first_page();
 
 	if ((page_bytes[pages_used - 1] + room_needed) > uint32_t(PAGE_SIZE_BYTES)) {
-		if (pages_used == max_pages) {
+		if (pages_used_counter->get() >= max_pages) {
 			fprintf(stderr, "Failed method: %s. Message queue out of memory. %s\n", String(p_callable).utf8().get_data(), error_text.utf8().get_data());
 			statistics();
 			UNLOCK_MUTEX;
@@ -136,13 +225,18 @@ Error CallQueue::push_callablep(const Callable &p_callable, const Variant **p_ar
 }
 
 Error CallQueue::push_set(ObjectID p_id, const StringName &p_prop, const Variant &p_value) {
+	CallQueue *staging_queue = _get_thread_staging_queue();
+	if (staging_queue) {
+		return staging_queue->push_set(p_id, p_prop, p_value);
+	}
+
 	LOCK_MUTEX;
 	uint32_t room_needed = sizeof(Message) + sizeof(Variant);
 
 	_ensure_first_page();
 
 	if ((page_bytes[pages_used - 1] + room_needed) > uint32_t(PAGE_SIZE_BYTES)) {
-		if (pages_used == max_pages) {
+		if (pages_used_counter->get() >= max_pages) {
 			String type;
 			if (ObjectDB::get_instance(p_id)) {
 				type = ObjectDB::get_instance(p_id)->get_class();
@@ -177,13 +271,19 @@ Error CallQueue::push_set(ObjectID p_id, const StringName &p_prop, const Variant
 
 Error CallQueue::push_notification(ObjectID p_id, int p_notification) {
 	ERR_FAIL_COND_V(p_notification < 0, ERR_INVALID_PARAMETER);
+
+	CallQueue *staging_queue = _get_thread_staging_queue();
+	if (staging_queue) {
+		return staging_queue->push_notification(p_id, p_notification);
+	}
+
 	LOCK_MUTEX;
 	uint32_t room_needed = sizeof(Message);
 
 	_ensure_first_page();
 
 	if ((page_bytes[pages_used - 1] + room_needed) > uint32_t(PAGE_SIZE_BYTES)) {
-		if (pages_used == max_pages) {
+		if (pages_used_counter->get() >= max_pages) {
 			fprintf(stderr, "Failed notification: %d target ID: %s. Message queue out of memory. %s\n", p_notification, itos(p_id).utf8().get_data(), error_text.utf8().get_data());
 			statistics();
 			UNLOCK_MUTEX;
@@ -228,15 +328,19 @@ void CallQueue::_call_function(const Callable &p_callable, const Variant *p_args
 Error CallQueue::flush() {
 	LOCK_MUTEX;
 
-	if (pages.is_empty()) {
-		// Never allocated
+	if (flushing) {
 		UNLOCK_MUTEX;
-		return OK; // Do nothing.
+		return ERR_BUSY;
 	}
 
-	if (flushing) {
+	if (thread_staging_enabled) {
+		_splice_thread_staging();
+	}
+
+	if (pages.is_empty()) {
+		// Never allocated
 		UNLOCK_MUTEX;
-		return ERR_BUSY;
+		return OK; // Do nothing.
 	}
 
 	flushing = true;
@@ -244,7 +348,15 @@ Error CallQueue::flush() {
 	uint32_t i = 0;
 	uint32_t offset = 0;
 
-	while (i < pages_used && offset < page_bytes[i]) {
+	while (true) {
+		if (i >= pages_used || offset >= page_bytes[i]) {
+			// Also call what other threads staged in the meantime, as happens with messages pushed here directly.
+			if (thread_staging_enabled && _splice_thread_staging()) {
+				continue;
+			}
+			break;
+		}
+
 		Page *page = pages[i];
 
 		//lock on each iteration, so a call can re-add itself to the message queue
@@ -300,7 +412,7 @@ Error CallQueue::flush() {
 	}
 
 	page_bytes[0] = 0;
-	pages_used = 1;
+	_set_pages_used(1);
 
 	flushing = false;
 	UNLOCK_MUTEX;
@@ -310,6 +422,10 @@ Error CallQueue::flush() {
 void CallQueue::clear() {
 	LOCK_MUTEX;
 
+	if (thread_staging_enabled) {
+		_splice_thread_staging();
+	}
+
 	if (pages.is_empty()) {
 		UNLOCK_MUTEX;
 		return; // Nothing to clear.
@@ -342,7 +458,7 @@ void CallQueue::clear() {
 		}
 	}
 
-	pages_used = 1;
+	_set_pages_used(1);
 	page_bytes[0] = 0;
 
 	UNLOCK_MUTEX;
@@ -476,6 +592,25 @@ CallQueue::CallQueue(Allocator *p_custom_allocator, uint32_t p_max_pages, const
 
 CallQueue::~CallQueue() {
 	clear();
+
+	{
+		MutexLock lock(thread_staging_mutex);
+		for (ThreadStaging *staging : thread_stagings) {
+			// Staged pages come from this queue's allocator, so they must be freed before it is.
+			CallQueue *queue = staging->queue;
+			queue->clear();
+			for (Page *page : queue->pages) {
+				allocator->free(page);
+			}
+			queue->pages.clear();
+			queue->page_bytes.clear();
+			queue->pages_used = 0;
+			queue->pages_used_counter = &queue->total_pages_used;
+			staging->owner_deleted.set();
+			_release_thread_staging(staging);
+		}
+		thread_stagings.clear();
+	}
 	// Let go of pages.
 	for (uint32_t i = 0; i < pages.size(); i++) {
 		allocator->free(pages[i]);
@@ -511,6 +646,7 @@ MessageQueue::MessageQueue() :
 				"Message queue out of memory. Try increasing 'memory/limits/message_queue/max_size_mb' in project settings.") {
 	ERR_FAIL_COND_MSG(main_singleton != nullptr, "A MessageQueue singleton already exists.");
 	main_singleton = this;
+	thread_staging_enabled = GLOBAL_DEF_RST("threading/message_queue/stage_thread_pushes", false);
 }
 
 MessageQueue::~MessageQueue() {
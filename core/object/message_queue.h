@@ -36,6 +36,7 @@
 #include "core/os/thread_safe.h"
 #include "core/templates/local_vector.h"
 #include "core/templates/paged_allocator.h"
+#include "core/templates/safe_refcount.h"
 #include "core/variant/variant.h"
 
 class Object;
@@ -78,10 +79,42 @@ private:
 	uint32_t pages_used = 0;
 	bool flushing = false;
 
+	// Pages used by this queue and its staging queues together, checked against `max_pages`.
+	// Staging queues count their pages in the counter of the queue they stage for, so they share its limit.
+	SafeNumeric<uint32_t> total_pages_used;
+	SafeNumeric<uint32_t> *pages_used_counter = &total_pages_used;
+
 #ifdef DEV_ENABLED
 	bool is_current_thread_override = false;
 #endif
 
+	// When enabled, messages pushed from threads other than the main one are staged in a queue of their own,
+	// so these threads don't contend on this queue's mutex. Staged pages are spliced into this queue when flushing,
+	// without copying the messages. Messages keep their order within a thread, but are called after the ones
+	// already pushed to this queue directly, so this is opt-in (see `threading/message_queue/stage_thread_pushes`).
+	struct ThreadStaging {
+		CallQueue *owner = nullptr;
+		CallQueue *queue = nullptr;
+		SafeRefCount refcount; // Held by both the thread and the owner.
+		SafeFlag thread_exited;
+		SafeFlag owner_deleted;
+	};
+
+	struct ThreadStagingHolder {
+		ThreadStaging *staging = nullptr;
+		~ThreadStagingHolder();
+	};
+
+	static thread_local ThreadStagingHolder thread_staging;
+
+	bool thread_staging_enabled = false;
+	Mutex thread_staging_mutex;
+	LocalVector<ThreadStaging *> thread_stagings;
+
+	static void _release_thread_staging(ThreadStaging *p_staging);
+	CallQueue *_get_thread_staging_queue();
+	bool _splice_thread_staging();
+
 	struct Message {
 		Callable callable;
 		int16_t type;
@@ -91,11 +124,20 @@ private:
 		};
 	};
 
+	_FORCE_INLINE_ void _set_pages_used(uint32_t p_pages_used) {
+		if (p_pages_used > pages_used) {
+			pages_used_counter->add(p_pages_used - pages_used);
+		} else if (p_pages_used < pages_used) {
+			pages_used_counter->sub(pages_used - p_pages_used);
+		}
+		pages_used = p_pages_used;
+	}
+
 	_FORCE_INLINE_ void _ensure_first_page() {
 		if (unlikely(pages.is_empty())) {
 			pages.push_back(allocator->alloc());
 			page_bytes.push_back(0);
-			pages_used = 1;
+			_set_pages_used(1);
 		}
 	}
 
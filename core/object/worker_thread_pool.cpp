@@ -32,6 +32,7 @@
 
 #include "worker_thread_pool.h"
 
+#include "core/debugger/trace_profiler.h"
 #include "core/object/script_language.h"
 #include "core/os/os.h"
 #include "core/os/safe_binary_mutex.h"
@@ -55,6 +56,8 @@ thread_local WorkerThreadPool::UnlockableLocks WorkerThreadPool::unlockable_lock
 #endif
 
 void WorkerThreadPool::_process_task(Task *p_task) {
+	TRACE_ZONE("WorkerThreadPool::_process_task");
+
 #ifdef THREADS_ENABLED
 	int pool_thread_index = thread_ids[Thread::get_caller_id()];
 	ThreadData &curr_thread = threads[pool_thread_index];
@@ -89,6 +92,8 @@ void WorkerThreadPool::_process_task(Task *p_task) {
 	bool low_priority = p_task->low_priority;
 #endif
 
+	LocalVector<Task *> ready_tasks; // Dependents unblocked by this task or group completing.
+
 	if (p_task->group) {
 		// Handling a group
 		bool do_post = false;
@@ -120,8 +125,11 @@ void WorkerThreadPool::_process_task(Task *p_task) {
 		}
 
 		if (do_post) {
-			p_task->group->done_semaphore.post();
+			task_mutex.lock();
 			p_task->group->completed.set_to(true);
+			_resolve_dependents(p_task->group->dependent_tasks, p_task->group->dependent_groups, ready_tasks);
+			task_mutex.unlock();
+			p_task->group->done_semaphore.post();
 		}
 		uint32_t max_users = p_task->group->tasks_used + 1; // Add 1 because the thread waiting for it is also user. Read before to avoid another thread freeing task after increment.
 		uint32_t finished_users = p_task->group->finished.increment();
@@ -149,6 +157,7 @@ void WorkerThreadPool::_process_task(Task *p_task) {
 		task_mutex.lock();
 		p_task->completed = true;
 		p_task->pool_thread_index = -1;
+		_resolve_dependents(p_task->dependent_tasks, p_task->dependent_groups, ready_tasks);
 		if (p_task->waiting_user) {
 			p_task->done_semaphore.post(p_task->waiting_user);
 		}
@@ -180,6 +189,10 @@ void WorkerThreadPool::_process_task(Task *p_task) {
 	set_current_thread_safe_for_nodes(safe_for_nodes_backup);
 	MessageQueue::set_thread_singleton_override(call_queue_backup);
 #endif
+
+	if (!ready_tasks.is_empty()) {
+		_post_ready_tasks(ready_tasks);
+	}
 }
 
 void WorkerThreadPool::_thread_function(void *p_user) {
@@ -187,8 +200,9 @@ void WorkerThreadPool::_thread_function(void *p_user) {
 	Thread::set_name(vformat("WorkerThread %d", thread_data->index));
 
 	while (true) {
-		Task *task_to_process = nullptr;
-		{
+		// Fast path: tasks posted by pool threads are taken without locking.
+		Task *task_to_process = thread_data->pool->_pop_local_task(thread_data);
+		if (!task_to_process) {
 			// Create the lock outside the inner loop so it isn't needlessly unlocked and relocked
 			//  when no task was found to process, and the loop is re-entered.
 			MutexLock lock(thread_data->pool->task_mutex);
@@ -201,17 +215,32 @@ void WorkerThreadPool::_thread_function(void *p_user) {
 
 				thread_data->signaled = false;
 
-				if (!thread_data->pool->task_queue.first()) {
-					// There wasn't a task available yet.
-					// Let's wait for the next notification, then recheck.
-					thread_data->cond_var.wait(lock);
+				if (thread_data->pool->task_queue.first()) {
+					// Got a task to process! Remove it from the queue, then break into the task handling section.
+					task_to_process = thread_data->pool->task_queue.first()->self();
+					thread_data->pool->task_queue.remove(thread_data->pool->task_queue.first());
+					break;
+				}
+
+				// Announce the intent to sleep before checking the local queues a last time.
+				// Paired with the fence in _post_tasks(), this ensures a lock-free post is never missed.
+				thread_data->pool->num_sleeping_threads.increment();
+				std::atomic_thread_fence(std::memory_order_seq_cst);
+				task_to_process = thread_data->pool->_pop_local_task(thread_data);
+				if (task_to_process) {
+					thread_data->pool->num_sleeping_threads.decrement();
+					break;
+				}
+				if (unlikely(thread_data->pool->runlevel == RUNLEVEL_PRE_EXIT_LANGUAGES && !thread_data->pre_exited_languages)) {
+					// The local queues may have just been drained by other threads. Re-evaluate idleness instead of sleeping.
+					thread_data->pool->num_sleeping_threads.decrement();
 					continue;
 				}
 
-				// Got a task to process! Remove it from the queue, then break into the task handling section.
-				task_to_process = thread_data->pool->task_queue.first()->self();
-				thread_data->pool->task_queue.remove(thread_data->pool->task_queue.first());
-				break;
+				// There wasn't a task available yet.
+				// Let's wait for the next notification, then recheck.
+				thread_data->cond_var.wait(lock);
+				thread_data->pool->num_sleeping_threads.decrement();
 			}
 		}
 
@@ -220,6 +249,7 @@ void WorkerThreadPool::_thread_function(void *p_user) {
 	}
 }
 
+// Note: The lock may be found released on return.
 void WorkerThreadPool::_post_tasks(Task **p_tasks, uint32_t p_count, bool p_high_priority, MutexLock<BinaryMutex> &p_lock) {
 	// Fall back to processing on the calling thread if there are no worker threads.
 	// Separated into its own variable to make it easier to extend this logic
@@ -243,6 +273,23 @@ void WorkerThreadPool::_post_tasks(Task **p_tasks, uint32_t p_count, bool p_high
 
 	ThreadData *caller_pool_thread = thread_ids.has(Thread::get_caller_id()) ? &threads[thread_ids[Thread::get_caller_id()]] : nullptr;
 
+	if (caller_pool_thread && p_high_priority) {
+		// Posted from one of our own threads: push to its work-stealing queue, which needs no lock.
+		// The mutex is only taken again if there are sleeping threads that have to be woken up.
+		p_lock.temp_unlock();
+		for (uint32_t i = 0; i < p_count; i++) {
+			p_tasks[i]->low_priority = false;
+			caller_pool_thread->work_queue.push(p_tasks[i]);
+		}
+		std::atomic_thread_fence(std::memory_order_seq_cst);
+		uint32_t sleeping = num_sleeping_threads.get();
+		if (sleeping) {
+			p_lock.temp_relock();
+			_notify_threads(caller_pool_thread, MIN(p_count, sleeping), 0);
+		}
+		return;
+	}
+
 	for (uint32_t i = 0; i < p_count; i++) {
 		p_tasks[i]->low_priority = !p_high_priority;
 		if (p_high_priority || low_priority_threads_used < max_low_priority_threads) {
@@ -325,6 +372,32 @@ void WorkerThreadPool::_notify_threads(const ThreadData *p_current_thread_data,
 	}
 }
 
+// Lock-free. Tries the caller's own queue first (LIFO), then steals from the other threads' ones (FIFO).
+WorkerThreadPool::Task *WorkerThreadPool::_pop_local_task(ThreadData *p_thread_data) {
+	Task *task = nullptr;
+	if (p_thread_data->work_queue.pop(task)) {
+		return task;
+	}
+
+	uint32_t thread_count = threads.size();
+	for (uint32_t i = 1; i < thread_count; i++) {
+		ThreadData &victim = threads[(p_thread_data->index + i) % thread_count];
+		if (victim.work_queue.steal(task)) {
+			return task;
+		}
+	}
+	return nullptr;
+}
+
+bool WorkerThreadPool::_has_local_tasks() const {
+	for (uint32_t i = 0; i < threads.size(); i++) {
+		if (!threads[i].work_queue.is_empty()) {
+			return true;
+		}
+	}
+	return false;
+}
+
 bool WorkerThreadPool::_try_promote_low_priority_task() {
 	if (low_priority_task_queue.first()) {
 		Task *low_prio_task = low_priority_task_queue.first()->self();
@@ -337,15 +410,89 @@ bool WorkerThreadPool::_try_promote_low_priority_task() {
 	}
 }
 
+// Hooks the task or group up to the uncompleted ones among the given IDs, and returns how many of those there are.
+// The caller must hold the lock.
+uint32_t WorkerThreadPool::_register_dependencies(Span<TaskID> p_dependencies, Task *p_task, Group *p_group) {
+	uint32_t pending = 0;
+	for (const TaskID dependency_id : p_dependencies) {
+		if (Task **taskp = tasks.getptr(dependency_id)) {
+			Task *dependency = *taskp;
+			if (dependency->completed) {
+				continue;
+			}
+			if (p_task) {
+				dependency->dependent_tasks.push_back(p_task);
+			} else {
+				dependency->dependent_groups.push_back(p_group);
+			}
+			pending++;
+		} else if (Group **groupp = groups.getptr(dependency_id)) {
+			Group *dependency = *groupp;
+			if (dependency->completed.is_set()) {
+				continue;
+			}
+			if (p_task) {
+				dependency->dependent_tasks.push_back(p_task);
+			} else {
+				dependency->dependent_groups.push_back(p_group);
+			}
+			pending++;
+		} else {
+			// Not found means already completed and awaited, unless it's not an ID issued so far.
+			ERR_CONTINUE_MSG(dependency_id <= 0 || dependency_id >= (TaskID)last_task, vformat("Invalid task or group ID passed as dependency: %d.", dependency_id));
+		}
+	}
+	return pending;
+}
+
+// The caller must hold the lock.
+void WorkerThreadPool::_resolve_dependents(LocalVector<Task *> &p_dependent_tasks, LocalVector<Group *> &p_dependent_groups, LocalVector<Task *> &r_ready_tasks) {
+	for (Task *dependent : p_dependent_tasks) {
+		dependent->pending_dependencies--;
+		if (dependent->pending_dependencies == 0) {
+			r_ready_tasks.push_back(dependent);
+		}
+	}
+	for (Group *dependent : p_dependent_groups) {
+		dependent->pending_dependencies--;
+		if (dependent->pending_dependencies == 0) {
+			for (Task *task : dependent->deferred_tasks) {
+				r_ready_tasks.push_back(task);
+			}
+			dependent->deferred_tasks.reset();
+		}
+	}
+	p_dependent_tasks.reset();
+	p_dependent_groups.reset();
+}
+
+void WorkerThreadPool::_post_ready_tasks(const LocalVector<Task *> &p_ready_tasks) {
+	// Each task was given the priority it was requested with when it was held back.
+	for (int i = 0; i < 2; i++) {
+		bool high_priority = i == 0;
+		LocalVector<Task *> to_post;
+		for (Task *task : p_ready_tasks) {
+			if (task->low_priority != high_priority) {
+				to_post.push_back(task);
+			}
+		}
+		if (!to_post.is_empty()) {
+			MutexLock<BinaryMutex> lock(task_mutex);
+			_post_tasks(to_post.ptr(), to_post.size(), high_priority, lock);
+		}
+	}
+}
+
 WorkerThreadPool::TaskID WorkerThreadPool::add_native_task(void (*p_func)(void *), void *p_userdata, bool p_high_priority, const String &p_description) {
 	return _add_task(Callable(), p_func, p_userdata, nullptr, p_high_priority, p_description);
 }
 
-WorkerThreadPool::TaskID WorkerThreadPool::_add_task(const Callable &p_callable, void (*p_func)(void *), void *p_userdata, BaseTemplateUserdata *p_template_userdata, bool p_high_priority, const String &p_description) {
+WorkerThreadPool::TaskID WorkerThreadPool::_add_task(const Callable &p_callable, void (*p_func)(void *), void *p_userdata, BaseTemplateUserdata *p_template_userdata, bool p_high_priority, const String &p_description, Span<TaskID> p_dependencies) {
 	MutexLock<BinaryMutex> lock(task_mutex);
 
 	// Get a free task
 	Task *task = task_allocator.alloc();
+	uint32_t pending_dependencies = _register_dependencies(p_dependencies, task, nullptr);
 	TaskID id = last_task++;
 	task->self = id;
 	task->callable = p_callable;
@@ -355,6 +502,13 @@ WorkerThreadPool::TaskID WorkerThreadPool::_add_task(const Callable &p_callable,
 	task->template_userdata = p_template_userdata;
 	tasks.insert(id, task);
 
+	if (pending_dependencies) {
+		// Posted once the last dependency is completed.
+		task->pending_dependencies = pending_dependencies;
+		task->low_priority = !p_high_priority;
+		return id;
+	}
+
 	_post_tasks(&task, 1, p_high_priority, lock);
 
 	return id;
@@ -364,6 +518,14 @@ WorkerThreadPool::TaskID WorkerThreadPool::add_task(const Callable &p_action, bo
 	return _add_task(p_action, nullptr, nullptr, nullptr, p_high_priority, p_description);
 }
 
+WorkerThreadPool::TaskID WorkerThreadPool::add_native_dependent_task(void (*p_func)(void *), void *p_userdata, Span<TaskID> p_dependencies, bool p_high_priority, const String &p_description) {
+	return _add_task(Callable(), p_func, p_userdata, nullptr, p_high_priority, p_description, p_dependencies);
+}
+
+WorkerThreadPool::TaskID WorkerThreadPool::add_dependent_task(const Callable &p_action, const PackedInt64Array &p_dependencies, bool p_high_priority, const String &p_description) {
+	return _add_task(p_action, nullptr, nullptr, nullptr, p_high_priority, p_description, Span<TaskID>(p_dependencies.ptr(), p_dependencies.size()));
+}
+
 bool WorkerThreadPool::is_task_completed(TaskID p_task_id) const {
 	MutexLock task_lock(task_mutex);
 	const Task *const *taskp = tasks.getptr(p_task_id);
@@ -492,7 +654,7 @@ void WorkerThreadPool::_wait_collaboratively(ThreadData *p_caller_pool_thread, T
 				if (was_signaled) {
 					// This thread was awaken for some additional reason, but it's about to exit.
 					// Let's find out what may be pending and forward the requests.
-					uint32_t to_process = task_queue.first() ? 1 : 0;
+					uint32_t to_process = (task_queue.first() || _has_local_tasks()) ? 1 : 0;
 					uint32_t to_promote = p_caller_pool_thread->current_task->low_priority && low_priority_task_queue.first() ? 1 : 0;
 					if (to_process || to_promote) {
 						// This thread must be left alone since it won't loop again.
@@ -510,11 +672,28 @@ void WorkerThreadPool::_wait_collaboratively(ThreadData *p_caller_pool_thread, T
 				}
 			}
 
-			if (p_caller_pool_thread->pool->task_queue.first()) {
+			// Own queue first, since it likely holds what is being awaited.
+			task_to_process = _pop_local_task(p_caller_pool_thread);
+
+			if (!task_to_process && p_caller_pool_thread->pool->task_queue.first()) {
 				task_to_process = task_queue.first()->self();
 				task_queue.remove(task_queue.first());
 			}
 
+			if (!task_to_process) {
+				// Same protocol as in _thread_function().
+				num_sleeping_threads.increment();
+				std::atomic_thread_fence(std::memory_order_seq_cst);
+				task_to_process = _pop_local_task(p_caller_pool_thread);
+				if (task_to_process) {
+					num_sleeping_threads.decrement();
+				} else if (unlikely(runlevel == RUNLEVEL_PRE_EXIT_LANGUAGES && !p_caller_pool_thread->pre_exited_languages)) {
+					// See _thread_function().
+					num_sleeping_threads.decrement();
+					continue;
+				}
+			}
+
 			if (!task_to_process) {
 				p_caller_pool_thread->awaited_task = p_task;
 
@@ -526,6 +705,7 @@ void WorkerThreadPool::_wait_collaboratively(ThreadData *p_caller_pool_thread, T
 				p_caller_pool_thread->cond_var.wait(lock);
 
 				p_caller_pool_thread->awaited_task = nullptr;
+				num_sleeping_threads.decrement();
 			}
 		}
 
@@ -558,7 +738,7 @@ bool WorkerThreadPool::_handle_runlevel(ThreadData *p_thread_data, MutexLock<Bin
 		} break;
 		case RUNLEVEL_PRE_EXIT_LANGUAGES: {
 			if (!p_thread_data->pre_exited_languages) {
-				if (!task_queue.first() && !low_priority_task_queue.first()) {
+				if (!task_queue.first() && !low_priority_task_queue.first() && !_has_local_tasks()) {
 					p_thread_data->pre_exited_languages = true;
 					runlevel_data.pre_exit_languages.num_idle_threads++;
 					control_cond_var.notify_all();
@@ -621,7 +801,7 @@ void WorkerThreadPool::notify_yield_over(TaskID p_task_id) {
 	td.cond_var.notify_one();
 }
 
-WorkerThreadPool::GroupID WorkerThreadPool::_add_group_task(const Callable &p_callable, void (*p_func)(void *, uint32_t), void *p_userdata, BaseTemplateUserdata *p_template_userdata, int p_elements, int p_tasks, bool p_high_priority, const String &p_description) {
+WorkerThreadPool::GroupID WorkerThreadPool::_add_group_task(const Callable &p_callable, void (*p_func)(void *, uint32_t), void *p_userdata, BaseTemplateUserdata *p_template_userdata, int p_elements, int p_tasks, bool p_high_priority, const String &p_description, Span<TaskID> p_dependencies) {
 	ERR_FAIL_COND_V(p_elements < 0, INVALID_TASK_ID);
 	if (p_tasks < 0) {
 		p_tasks = MAX(1u, threads.size());
@@ -630,6 +810,8 @@ WorkerThreadPool::GroupID WorkerThreadPool::_add_group_task(const Callable &p_ca
 	MutexLock<BinaryMutex> lock(task_mutex);
 
 	Group *group = group_allocator.alloc();
+	// An empty group is completed right away, so it has nothing to wait for.
+	uint32_t pending_dependencies = p_elements > 0 ? _register_dependencies(p_dependencies, nullptr, group) : 0;
 	GroupID id = last_task++;
 	group->max = p_elements;
 	group->self = id;
@@ -656,6 +838,7 @@ WorkerThreadPool::GroupID WorkerThreadPool::_add_group_task(const Callable &p_ca
 			task->group = group;
 			task->callable = p_callable;
 			task->template_userdata = p_template_userdata;
+			task->low_priority = !p_high_priority;
 			tasks_posted[i] = task;
 			// No task ID is used.
 		}
@@ -663,6 +846,16 @@ WorkerThreadPool::GroupID WorkerThreadPool::_add_group_task(const Callable &p_ca
 
 	groups[id] = group;
 
+	if (pending_dependencies) {
+		// Posted once the last dependency is completed.
+		group->pending_dependencies = pending_dependencies;
+		group->deferred_tasks.resize(p_tasks);
+		for (int i = 0; i < p_tasks; i++) {
+			group->deferred_tasks[i] = tasks_posted[i];
+		}
+		return id;
+	}
+
 	_post_tasks(tasks_posted, p_tasks, p_high_priority, lock);
 
 	return id;
@@ -676,6 +869,14 @@ WorkerThreadPool::GroupID WorkerThreadPool::add_group_task(const Callable &p_act
 	return _add_group_task(p_action, nullptr, nullptr, nullptr, p_elements, p_tasks, p_high_priority, p_description);
 }
 
+WorkerThreadPool::GroupID WorkerThreadPool::add_native_dependent_group_task(void (*p_func)(void *, uint32_t), void *p_userdata, int p_elements, Span<TaskID> p_dependencies, int p_tasks, bool p_high_priority, const String &p_description) {
+	return _add_group_task(Callable(), p_func, p_userdata, nullptr, p_elements, p_tasks, p_high_priority, p_description, p_dependencies);
+}
+
+WorkerThreadPool::GroupID WorkerThreadPool::add_dependent_group_task(const Callable &p_action, int p_elements, const PackedInt64Array &p_dependencies, int p_tasks, bool p_high_priority, const String &p_description) {
+	return _add_group_task(p_action, nullptr, nullptr, nullptr, p_elements, p_tasks, p_high_priority, p_description, Span<TaskID>(p_dependencies.ptr(), p_dependencies.size()));
+}
+
 uint32_t WorkerThreadPool::get_group_processed_element_count(GroupID p_group) const {
 	MutexLock task_lock(task_mutex);
 	const Group *const *groupp = groups.getptr(p_group);
@@ -863,6 +1064,9 @@ void WorkerThreadPool::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("is_group_task_completed", "group_id"), &WorkerThreadPool::is_group_task_completed);
 	ClassDB::bind_method(D_METHOD("get_group_processed_element_count", "group_id"), &WorkerThreadPool::get_group_processed_element_count);
 	ClassDB::bind_method(D_METHOD("wait_for_group_task_completion", "group_id"), &WorkerThreadPool::wait_for_group_task_completion);
+
+	ClassDB::bind_method(D_METHOD("add_dependent_task", "action", "dependencies", "high_priority", "description"), &WorkerThreadPool::add_dependent_task, DEFVAL(false), DEFVAL(String()));
+	ClassDB::bind_method(D_METHOD("add_dependent_group_task", "action", "elements", "dependencies", "tasks_needed", "high_priority", "description"), &WorkerThreadPool::add_dependent_group_task, DEFVAL(-1), DEFVAL(false), DEFVAL(String()));
 }
 
 WorkerThreadPool *WorkerThreadPool::get_named_pool(const StringName &p_name) {
@@ -41,6 +41,8 @@
 #include "core/templates/paged_allocator.h"
 #include "core/templates/rid.h"
 #include "core/templates/safe_refcount.h"
+#include "core/templates/span.h"
+#include "core/templates/work_stealing_deque.h"
 
 class WorkerThreadPool : public Object {
 	GDCLASS(WorkerThreadPool, Object)
@@ -70,6 +72,10 @@ private:
 		SafeFlag completed;
 		SafeNumeric<uint32_t> finished;
 		uint32_t tasks_used = 0;
+		uint32_t pending_dependencies = 0;
+		LocalVector<Task *> deferred_tasks; // Held back until all the dependencies are completed.
+		LocalVector<Task *> dependent_tasks;
+		LocalVector<Group *> dependent_groups;
 	};
 
 	struct Task {
@@ -89,6 +95,9 @@ private:
 		bool low_priority = false;
 		BaseTemplateUserdata *template_userdata = nullptr;
 		int pool_thread_index = -1;
+		uint32_t pending_dependencies = 0;
+		LocalVector<Task *> dependent_tasks;
+		LocalVector<Group *> dependent_groups;
 
 		void free_template_userdata();
 		Task() :
@@ -121,6 +130,8 @@ private:
 		Task *awaited_task = nullptr; // Null if not awaiting the condition variable, or special value (YIELDING).
 		ConditionVariable cond_var;
 		WorkerThreadPool *pool = nullptr;
+		// High priority tasks posted from this thread. Other pool threads steal from it when idle.
+		WorkStealingDeque<Task *> work_queue;
 
 		ThreadData() :
 				signaled(false),
@@ -165,6 +176,7 @@ private:
 	uint32_t max_low_priority_threads = 0;
 	uint32_t low_priority_threads_used = 0;
 	uint32_t notify_index = 0; // For rotating across threads, no help distributing load.
+	SafeNumeric<uint32_t> num_sleeping_threads; // Lets lock-free posting skip the mutex when nobody needs waking up.
 
 	uint64_t last_task = 1;
 
@@ -177,8 +189,15 @@ private:
 	void _post_tasks(Task **p_tasks, uint32_t p_count, bool p_high_priority, MutexLock<BinaryMutex> &p_lock);
 	void _notify_threads(const ThreadData *p_current_thread_data, uint32_t p_process_count, uint32_t p_promote_count);
 
+	Task *_pop_local_task(ThreadData *p_thread_data);
+	bool _has_local_tasks() const;
+
 	bool _try_promote_low_priority_task();
 
+	uint32_t _register_dependencies(Span<TaskID> p_dependencies, Task *p_task, Group *p_group);
+	void _resolve_dependents(LocalVector<Task *> &p_dependent_tasks, LocalVector<Group *> &p_dependent_groups, LocalVector<Task *> &r_ready_tasks);
+	void _post_ready_tasks(const LocalVector<Task *> &p_ready_tasks);
+
 	static WorkerThreadPool *singleton;
 
 #ifdef THREADS_ENABLED
@@ -190,8 +209,8 @@ private:
 	static thread_local UnlockableLocks unlockable_locks[MAX_UNLOCKABLE_LOCKS];
 #endif
 
-	TaskID _add_task(const Callable &p_callable, void (*p_func)(void *), void *p_userdata, BaseTemplateUserdata *p_template_userdata, bool p_high_priority, const String &p_description);
-	GroupID _add_group_task(const Callable &p_callable, void (*p_func)(void *, uint32_t), void *p_userdata, BaseTemplateUserdata *p_template_userdata, int p_elements, int p_tasks, bool p_high_priority, const String &p_description);
+	TaskID _add_task(const Callable &p_callable, void (*p_func)(void *), void *p_userdata, BaseTemplateUserdata *p_template_userdata, bool p_high_priority, const String &p_description, Span<TaskID> p_dependencies = Span<TaskID>());
+	GroupID _add_group_task(const Callable &p_callable, void (*p_func)(void *, uint32_t), void *p_userdata, BaseTemplateUserdata *p_template_userdata, int p_elements, int p_tasks, bool p_high_priority, const String &p_description, Span<TaskID> p_dependencies = Span<TaskID>());
 
 	template <typename C, typename M, typename U>
 	struct TaskUserData : public BaseTemplateUserdata {
@@ -241,6 +260,19 @@ public:
 	TaskID add_native_task(void (*p_func)(void *), void *p_userdata, bool p_high_priority = false, const String &p_description = String());
 	TaskID add_task(const Callable &p_action, bool p_high_priority = false, const String &p_description = String());
 
+	// Dependent tasks are held back until all the tasks and groups they depend on are completed.
+	template <typename C, typename M, typename U>
+	TaskID add_template_dependent_task(C *p_instance, M p_method, U p_userdata, Span<TaskID> p_dependencies, bool p_high_priority = false, const String &p_description = String()) {
+		typedef TaskUserData<C, M, U> TUD;
+		TUD *ud = memnew(TUD);
+		ud->instance = p_instance;
+		ud->method = p_method;
+		ud->userdata = p_userdata;
+		return _add_task(Callable(), nullptr, nullptr, ud, p_high_priority, p_description, p_dependencies);
+	}
+	TaskID add_native_dependent_task(void (*p_func)(void *), void *p_userdata, Span<TaskID> p_dependencies, bool p_high_priority = false, const String &p_description = String());
+	TaskID add_dependent_task(const Callable &p_action, const PackedInt64Array &p_dependencies, bool p_high_priority = false, const String &p_description = String());
+
 	bool is_task_completed(TaskID p_task_id) const;
 	Error wait_for_task_completion(TaskID p_task_id);
 
@@ -258,6 +290,18 @@ public:
 	}
 	GroupID add_native_group_task(void (*p_func)(void *, uint32_t), void *p_userdata, int p_elements, int p_tasks = -1, bool p_high_priority = false, const String &p_description = String());
 	GroupID add_group_task(const Callable &p_action, int p_elements, int p_tasks = -1, bool p_high_priority = false, const String &p_description = String());
+
+	template <typename C, typename M, typename U>
+	GroupID add_template_dependent_group_task(C *p_instance, M p_method, U p_userdata, int p_elements, Span<TaskID> p_dependencies, int p_tasks = -1, bool p_high_priority = false, const String &p_description = String()) {
+		typedef GroupUserData<C, M, U> GroupUD;
+		GroupUD *ud = memnew(GroupUD);
+		ud->instance = p_instance;
+		ud->method = p_method;
+		ud->userdata = p_userdata;
+		return _add_group_task(Callable(), nullptr, nullptr, ud, p_elements, p_tasks, p_high_priority, p_description, p_dependencies);
+	}
+	GroupID add_native_dependent_group_task(void (*p_func)(void *, uint32_t), void *p_userdata, int p_elements, Span<TaskID> p_dependencies, int p_tasks = -1, bool p_high_priority = false, const String &p_description = String());
+	GroupID add_dependent_group_task(const Callable &p_action, int p_elements, const PackedInt64Array &p_dependencies, int p_tasks = -1, bool p_high_priority = false, const String &p_description = String());
 	uint32_t get_group_processed_element_count(GroupID p_group) const;
 	bool is_group_task_completed(GroupID p_group) const;
 	void wait_for_group_task_completion(GroupID p_group);
@@ -39,6 +39,7 @@
 #include "core/crypto/crypto.h"
 #include "core/crypto/hashing_context.h"
 #include "core/debugger/engine_profiler.h"
+#include "core/debugger/trace_profiler.h"
 #include "core/extension/gdextension.h"
 #include "core/extension/gdextension_manager.h"
 #include "core/input/input.h"
@@ -420,6 +421,11 @@ void unregister_core_types() {
 
 	memdelete(worker_thread_pool);
 
+#ifdef TRACE_PROFILER_ENABLED
+	// No other thread can record zones anymore.
+	TraceProfiler::finish();
+#endif
+
 	memdelete(_engine_debugger);
 	memdelete(_marshalls);
 	memdelete(_classdb);
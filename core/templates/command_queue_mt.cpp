@@ -32,8 +32,14 @@
 
 #include "command_queue_mt.h"
 
+std::atomic<uint32_t> CommandQueueMT::producer_thread_count{ 0 };
+
 CommandQueueMT::CommandQueueMT() {
-	command_mem.reserve(DEFAULT_COMMAND_MEM_SIZE_KB * 1024);
+	// Slots trade their memory with the flush buffers, so both sides keep their capacity.
+	for (uint32_t i = 0; i < PRODUCER_SLOT_COUNT; i++) {
+		producer_slots[i].command_mem.reserve(DEFAULT_COMMAND_MEM_SIZE_KB * 1024 / PRODUCER_SLOT_COUNT);
+		flush_mem[i].reserve(DEFAULT_COMMAND_MEM_SIZE_KB * 1024 / PRODUCER_SLOT_COUNT);
+	}
 }
 
 CommandQueueMT::~CommandQueueMT() {
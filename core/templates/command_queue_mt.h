@@ -40,6 +40,8 @@
 #include "core/templates/tuple.h"
 #include "core/typedefs.h"
 
+#include <atomic>
+
 class CommandQueueMT {
 	struct CommandBase {
 		bool sync = false;
@@ -107,102 +109,164 @@ class CommandQueueMT {
 
 	static const uint32_t DEFAULT_COMMAND_MEM_SIZE_KB = 64;
 
-	BinaryMutex mutex;
-	LocalVector<uint8_t> command_mem;
-	ConditionVariable sync_cond_var;
-	uint32_t sync_head = 0;
-	uint32_t sync_tail = 0;
-	uint32_t sync_awaiters = 0;
-	WorkerThreadPool::TaskID pump_task_id = WorkerThreadPool::INVALID_TASK_ID;
-	uint64_t flush_read_ptr = 0;
+	// Producer threads are spread over these slots, so they only contend with the few threads sharing their slot.
+	// Every command is tagged with a global sequence number, which flushing uses to call them in the order
+	// they were pushed, whichever slots they were pushed to.
+	static const uint32_t PRODUCER_SLOT_COUNT = 16;
+
+	struct CommandHeader {
+		uint64_t size = 0;
+		uint64_t seq = 0;
+	};
+
+	struct ProducerSlot {
+		BinaryMutex mutex;
+		LocalVector<uint8_t> command_mem;
+	};
+
+	ProducerSlot producer_slots[PRODUCER_SLOT_COUNT];
+	std::atomic<uint64_t> next_seq{ 0 };
 	std::atomic<bool> pending{ false };
+	std::atomic<WorkerThreadPool::TaskID> pump_task_id{ WorkerThreadPool::INVALID_TASK_ID };
+
+	BinaryMutex flush_mutex;
+	LocalVector<uint8_t> flush_mem[PRODUCER_SLOT_COUNT];
+	bool flushing = false;
+
+	BinaryMutex sync_mutex;
+	ConditionVariable sync_cond_var;
+	uint64_t synced_seq = 0; // All sync commands with a lower sequence number have been called.
+
+	static inline thread_local uint32_t producer_slot = UINT32_MAX;
+	static std::atomic<uint32_t> producer_thread_count;
+
+	_FORCE_INLINE_ static uint32_t _get_producer_slot() {
+		if (unlikely(producer_slot == UINT32_MAX)) {
+			producer_slot = producer_thread_count.fetch_add(1, std::memory_order_relaxed) % PRODUCER_SLOT_COUNT;
+		}
+		return producer_slot;
+	}
 
 	template <typename T, typename... Args>
-	_FORCE_INLINE_ void create_command(Args &&...p_args) {
+	_FORCE_INLINE_ uint64_t create_command(LocalVector<uint8_t> &r_command_mem, Args &&...p_args) {
 		// alloc size is size+T+safeguard
 		constexpr uint64_t alloc_size = ((sizeof(T) + 8U - 1U) & ~(8U - 1U));
 		static_assert(alloc_size < UINT32_MAX, "Type too large to fit in the command queue.");
 
-		uint64_t size = command_mem.size();
-		command_mem.resize(size + alloc_size + sizeof(uint64_t));
-		*(uint64_t *)&command_mem[size] = alloc_size;
-		void *cmd = &command_mem[size + sizeof(uint64_t)];
+		uint64_t size = r_command_mem.size();
+		r_command_mem.resize(size + sizeof(CommandHeader) + alloc_size);
+		CommandHeader *header = (CommandHeader *)&r_command_mem[size];
+		header->size = alloc_size;
+		// Taken while holding the slot lock, so a flush locking all slots sees every numbered command.
+		header->seq = next_seq.fetch_add(1, std::memory_order_relaxed);
+		void *cmd = &r_command_mem[size + sizeof(CommandHeader)];
 		new (cmd) T(std::forward<Args>(p_args)...);
 		pending.store(true);
+		return header->seq;
 	}
 
 	template <typename T, bool NeedsSync, typename... Args>
 	_FORCE_INLINE_ void _push_internal(Args &&...args) {
-		MutexLock mlock(mutex);
-		create_command<T>(std::forward<Args>(args)...);
-
-		if (pump_task_id != WorkerThreadPool::INVALID_TASK_ID) {
-			WorkerThreadPool::get_singleton()->notify_yield_over(pump_task_id);
+		uint64_t seq;
+		{
+			ProducerSlot &slot = producer_slots[_get_producer_slot()];
+			MutexLock mlock(slot.mutex);
+			seq = create_command<T>(slot.command_mem, std::forward<Args>(args)...);
 		}
 
-		if constexpr (NeedsSync) {
-			sync_tail++;
-			_wait_for_sync(mlock);
+		WorkerThreadPool::TaskID pump_task = pump_task_id.load(std::memory_order_relaxed);
+		if (pump_task != WorkerThreadPool::INVALID_TASK_ID) {
+			WorkerThreadPool::get_singleton()->notify_yield_over(pump_task);
 		}
-	}
 
-	_FORCE_INLINE_ void _prevent_sync_wraparound() {
-		bool safe_to_reset = !sync_awaiters;
-		bool already_sync_to_latest = sync_head == sync_tail;
-		if (safe_to_reset && already_sync_to_latest) {
-			sync_head = 0;
-			sync_tail = 0;
+		if constexpr (NeedsSync) {
+			_wait_for_sync(seq);
 		}
 	}
 
 	void _flush() {
-		if (unlikely(flush_read_ptr)) {
+		if (unlikely(flushing)) {
 			// Re-entrant call.
 			return;
 		}
 
-		MutexLock lock(mutex);
+		MutexLock lock(flush_mutex);
+		if (unlikely(flushing)) {
+			// Another thread is flushing, and released the lock while a command waits for a task.
+			return;
+		}
+		flushing = true;
+
+		// Take the commands of all slots at once. Since sequence numbers are assigned under the slot locks,
+		// no command older than the ones taken can be left behind.
+		for (ProducerSlot &slot : producer_slots) {
+			slot.mutex.lock();
+		}
+		for (uint32_t i = 0; i < PRODUCER_SLOT_COUNT; i++) {
+			SWAP(producer_slots[i].command_mem, flush_mem[i]);
+		}
+		pending.store(false);
+		for (ProducerSlot &slot : producer_slots) {
+			slot.mutex.unlock();
+		}
+
+		uint32_t active_slots[PRODUCER_SLOT_COUNT];
+		uint64_t read_ptrs[PRODUCER_SLOT_COUNT];
+		uint32_t active_count = 0;
+		for (uint32_t i = 0; i < PRODUCER_SLOT_COUNT; i++) {
+			if (!flush_mem[i].is_empty()) {
+				active_slots[active_count++] = i;
+				read_ptrs[i] = 0;
+			}
+		}
+
+		while (active_count) {
+			// Merge the slots by calling the oldest remaining command first.
+			uint32_t oldest = 0;
+			uint64_t oldest_seq = UINT64_MAX;
+			for (uint32_t i = 0; i < active_count; i++) {
+				uint32_t slot = active_slots[i];
+				uint64_t seq = ((CommandHeader *)&flush_mem[slot][read_ptrs[slot]])->seq;
+				if (seq < oldest_seq) {
+					oldest = i;
+					oldest_seq = seq;
+				}
+			}
+
+			uint32_t slot = active_slots[oldest];
+			LocalVector<uint8_t> &mem = flush_mem[slot];
+			uint64_t size = ((CommandHeader *)&mem[read_ptrs[slot]])->size;
+			CommandBase *cmd = reinterpret_cast<CommandBase *>(&mem[read_ptrs[slot] + sizeof(CommandHeader)]);
 
-		while (flush_read_ptr < command_mem.size()) {
-			uint64_t size = *(uint64_t *)&command_mem[flush_read_ptr];
-			flush_read_ptr += 8;
-			CommandBase *cmd = reinterpret_cast<CommandBase *>(&command_mem[flush_read_ptr]);
 			uint32_t allowance_id = WorkerThreadPool::thread_enter_unlock_allowance_zone(lock);
 			cmd->call();
 			WorkerThreadPool::thread_exit_unlock_allowance_zone(allowance_id);
 
-			// Handle potential realloc due to the command and unlock allowance.
-			cmd = reinterpret_cast<CommandBase *>(&command_mem[flush_read_ptr]);
-
 			if (unlikely(cmd->sync)) {
-				sync_head++;
-				lock.~MutexLock(); // Give an opportunity to awaiters right away.
+				{
+					MutexLock sync_lock(sync_mutex);
+					synced_seq = oldest_seq + 1;
+				}
 				sync_cond_var.notify_all();
-				new (&lock) MutexLock(mutex);
-				// Handle potential realloc happened during unlock.
-				cmd = reinterpret_cast<CommandBase *>(&command_mem[flush_read_ptr]);
 			}
 
 			cmd->~CommandBase();
 
-			flush_read_ptr += size;
+			read_ptrs[slot] += sizeof(CommandHeader) + size;
+			if (read_ptrs[slot] >= mem.size()) {
+				mem.clear();
+				active_slots[oldest] = active_slots[--active_count];
+			}
 		}
 
-		command_mem.clear();
-		pending.store(false);
-		flush_read_ptr = 0;
-
-		_prevent_sync_wraparound();
+		flushing = false;
 	}
 
-	_FORCE_INLINE_ void _wait_for_sync(MutexLock<BinaryMutex> &p_lock) {
-		sync_awaiters++;
-		uint32_t sync_head_goal = sync_tail;
-		do {
-			sync_cond_var.wait(p_lock);
-		} while (sync_head < sync_head_goal);
-		sync_awaiters--;
-		_prevent_sync_wraparound();
+	_FORCE_INLINE_ void _wait_for_sync(uint64_t p_seq) {
+		MutexLock sync_lock(sync_mutex);
+		while (synced_seq <= p_seq) {
+			sync_cond_var.wait(sync_lock);
+		}
 	}
 
 	void _no_op() {}
@@ -250,8 +314,7 @@ public:
 	}
 
 	void set_pump_task_id(WorkerThreadPool::TaskID p_task_id) {
-		MutexLock lock(mutex);
-		pump_task_id = p_task_id;
+		pump_task_id.store(p_task_id);
 	}
 
 	CommandQueueMT();
@@ -42,6 +42,9 @@
 
 static_assert(std::is_trivially_destructible_v<std::atomic<uint64_t>>);
 
+// Frees the memory of CowData buffers set with `set_external()`, given their data pointer.
+inline void (*cowdata_external_free_func)(void *p_data) = nullptr;
+
 GODOT_GCC_WARNING_PUSH
 GODOT_GCC_WARNING_IGNORE("-Wplacement-new") // Silence a false positive warning (see GH-52119).
 GODOT_GCC_WARNING_IGNORE("-Wmaybe-uninitialized") // False positive raised when using constexpr.
@@ -84,6 +87,10 @@ private:
 	static constexpr size_t SIZE_OFFSET = ((REF_COUNT_OFFSET + sizeof(SafeNumeric<USize>)) % alignof(USize) == 0) ? (REF_COUNT_OFFSET + sizeof(SafeNumeric<USize>)) : ((REF_COUNT_OFFSET + sizeof(SafeNumeric<USize>)) + alignof(USize) - ((REF_COUNT_OFFSET + sizeof(SafeNumeric<USize>)) % alignof(USize)));
 	static constexpr size_t DATA_OFFSET = ((SIZE_OFFSET + sizeof(USize)) % alignof(max_align_t) == 0) ? (SIZE_OFFSET + sizeof(USize)) : ((SIZE_OFFSET + sizeof(USize)) + alignof(max_align_t) - ((SIZE_OFFSET + sizeof(USize)) % alignof(max_align_t)));
 
+	// Set in the reference count of buffers not allocated by CowData, which must never be written to
+	// nor reallocated. Since the count never equals 1, they are always copied before being written to.
+	static constexpr USize EXTERNAL_FLAG = USize(1) << 63;
+
 	mutable T *_ptr = nullptr;
 
 	// internal helpers
@@ -192,6 +199,22 @@ public:
 	_FORCE_INLINE_ void clear() { _unref(); }
 	_FORCE_INLINE_ bool is_empty() const { return _ptr == nullptr; }
 
+	// Bytes needed before the data of external buffers, to hold the reference count and size.
+	static constexpr size_t EXTERNAL_HEADER_SIZE = DATA_OFFSET;
+
+	// Wraps read-only memory owned elsewhere instead of copying it. The EXTERNAL_HEADER_SIZE bytes
+	// before p_data must be writable and aligned like the data of a regular buffer. Once unreferenced,
+	// the memory is freed with `cowdata_external_free_func`.
+	void set_external(T *p_data, Size p_size) {
+		static_assert(std::is_trivially_destructible_v<T>);
+		DEV_ASSERT(p_size > 0 && ((uintptr_t)p_data % alignof(USize)) == 0);
+		_unref();
+		_ptr = p_data;
+		new (_get_refcount()) SafeNumeric<USize>(EXTERNAL_FLAG | 1);
+		*_get_size() = p_size;
+	}
+	_FORCE_INLINE_ bool is_external() const { return _ptr && (_get_refcount()->get() & EXTERNAL_FLAG); }
+
 	_FORCE_INLINE_ void set(Size p_index, const T &p_elem) {
 		ERR_FAIL_INDEX(p_index, size());
 		_copy_on_write();
@@ -258,11 +281,20 @@ void CowData<T>::_unref() {
 	}
 
 	SafeNumeric<USize> *refc = _get_refcount();
-	if (refc->decrement() > 0) {
+	const USize remaining = refc->decrement();
+	if (remaining & ~EXTERNAL_FLAG) {
 		// Data is still in use elsewhere.
 		_ptr = nullptr;
 		return;
 	}
+
+	if (unlikely(remaining & EXTERNAL_FLAG)) {
+		// Nothing to destruct, external buffers only hold trivially destructible types.
+		T *prev_ptr = _ptr;
+		_ptr = nullptr;
+		cowdata_external_free_func(prev_ptr);
+		return;
+	}
 	// We had the only reference; destroy the data.
 
 	// First, invalidate our own reference.
@@ -98,6 +98,11 @@ public:
 	_FORCE_INLINE_ void clear() { _cowdata.clear(); }
 	_FORCE_INLINE_ bool is_empty() const { return _cowdata.is_empty(); }
 
+	// See CowData::set_external().
+	static constexpr size_t EXTERNAL_HEADER_SIZE = CowData<T>::EXTERNAL_HEADER_SIZE;
+	void set_external(T *p_data, Size p_size) { _cowdata.set_external(p_data, p_size); }
+	_FORCE_INLINE_ bool is_external() const { return _cowdata.is_external(); }
+
 	_FORCE_INLINE_ T get(Size p_index) { return _cowdata.get(p_index); }
 	_FORCE_INLINE_ const T &get(Size p_index) const { return _cowdata.get(p_index); }
 	_FORCE_INLINE_ void set(Size p_index, const T &p_elem) { _cowdata.set(p_index, p_elem); }
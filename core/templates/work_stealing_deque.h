@@ -0,0 +1,180 @@
+/**************************************************************************/
+/*  work_stealing_deque.h                                                 */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             REDOT ENGINE                               */
+/*                        https://redotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2024-present Redot Engine contributors                   */
+/*                                          (see REDOT_AUTHORS.md)        */
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+
+#include "core/error/error_macros.h"
+#include "core/os/memory.h"
+#include "core/typedefs.h"
+
+#include <atomic>
+#include <type_traits>
+
+// Chase-Lev work-stealing deque, following the C11 formulation by Lê, Pop, Cohen and Zappa Nardelli
+// ("Correct and Efficient Work-Stealing for Weak Memory Models", PPoPP 2013).
+// - push() and pop() may only be called by the owner thread, and work on the bottom end (LIFO).
+// - steal() may be called by any thread, and works on the top end (FIFO).
+// The buffer grows as needed. Retired buffers are kept alive until the deque is destroyed,
+// since a thief may still be reading from them.
+template <typename T>
+class WorkStealingDeque {
+	static_assert(std::is_trivially_copyable_v<T>);
+	static_assert(std::atomic<T>::is_always_lock_free);
+
+	struct Buffer {
+		int64_t capacity = 0;
+		int64_t mask = 0;
+		Buffer *retired_next = nullptr;
+		std::atomic<T> *items = nullptr;
+
+		_FORCE_INLINE_ T get(int64_t p_index) const {
+			return items[p_index & mask].load(std::memory_order_relaxed);
+		}
+		_FORCE_INLINE_ void put(int64_t p_index, T p_value) {
+			items[p_index & mask].store(p_value, std::memory_order_relaxed);
+		}
+	};
+
+	std::atomic<int64_t> top;
+	uint8_t padding[64 - sizeof(std::atomic<int64_t>)]; // Keep thieves and the owner off the same cache line.
+	std::atomic<int64_t> bottom;
+	std::atomic<Buffer *> buffer;
+	Buffer *retired = nullptr; // Only touched by the owner.
+
+	static Buffer *_alloc_buffer(int64_t p_capacity) {
+		Buffer *b = memnew(Buffer);
+		b->capacity = p_capacity;
+		b->mask = p_capacity - 1;
+		b->items = (std::atomic<T> *)memalloc(sizeof(std::atomic<T>) * p_capacity);
+		for (int64_t i = 0; i < p_capacity; i++) {
+			memnew_placement(&b->items[i], std::atomic<T>);
+		}
+		return b;
+	}
+
+	static void _free_buffer(Buffer *p_buffer) {
+		memfree(p_buffer->items);
+		memdelete(p_buffer);
+	}
+
+	Buffer *_grow(Buffer *p_old, int64_t p_bottom, int64_t p_top) {
+		Buffer *b = _alloc_buffer(p_old->capacity * 2);
+		for (int64_t i = p_top; i < p_bottom; i++) {
+			b->put(i, p_old->get(i));
+		}
+		p_old->retired_next = retired;
+		retired = p_old;
+		buffer.store(b, std::memory_order_release);
+		return b;
+	}
+
+public:
+	// Owner only.
+	void push(T p_value) {
+		int64_t b = bottom.load(std::memory_order_relaxed);
+		int64_t t = top.load(std::memory_order_acquire);
+		Buffer *buf = buffer.load(std::memory_order_relaxed);
+		if (unlikely(b - t > buf->capacity - 1)) {
+			buf = _grow(buf, b, t);
+		}
+		buf->put(b, p_value);
+		std::atomic_thread_fence(std::memory_order_release);
+		bottom.store(b + 1, std::memory_order_relaxed);
+	}
+
+	// Owner only. Returns false if the deque was empty.
+	bool pop(T &r_value) {
+		int64_t b = bottom.load(std::memory_order_relaxed) - 1;
+		Buffer *buf = buffer.load(std::memory_order_relaxed);
+		bottom.store(b, std::memory_order_relaxed);
+		std::atomic_thread_fence(std::memory_order_seq_cst);
+		int64_t t = top.load(std::memory_order_relaxed);
+
+		if (t > b) {
+			// Empty.
+			bottom.store(b + 1, std::memory_order_relaxed);
+			return false;
+		}
+
+		r_value = buf->get(b);
+		if (t == b) {
+			// Last item; race against thieves for it.
+			bool won = top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed);
+			bottom.store(b + 1, std::memory_order_relaxed);
+			return won;
+		}
+		return true;
+	}
+
+	// Any thread. Returns false only if the deque was observed empty;
+	// losing a race against another thief or the owner makes it retry.
+	bool steal(T &r_value) {
+		while (true) {
+			int64_t t = top.load(std::memory_order_acquire);
+			std::atomic_thread_fence(std::memory_order_seq_cst);
+			int64_t b = bottom.load(std::memory_order_acquire);
+			if (t >= b) {
+				return false;
+			}
+
+			Buffer *buf = buffer.load(std::memory_order_acquire);
+			T value = buf->get(t);
+			if (top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed)) {
+				r_value = value;
+				return true;
+			}
+		}
+	}
+
+	// Any thread. Only a hint, unless called by the owner with no thieves around.
+	_FORCE_INLINE_ bool is_empty() const {
+		int64_t b = bottom.load(std::memory_order_acquire);
+		int64_t t = top.load(std::memory_order_acquire);
+		return t >= b;
+	}
+
+	WorkStealingDeque(int64_t p_initial_capacity = 64) {
+		DEV_ASSERT(p_initial_capacity > 0 && (p_initial_capacity & (p_initial_capacity - 1)) == 0);
+		top.store(0, std::memory_order_relaxed);
+		bottom.store(0, std::memory_order_relaxed);
+		buffer.store(_alloc_buffer(p_initial_capacity), std::memory_order_relaxed);
+	}
+
+	~WorkStealingDeque() {
+		_free_buffer(buffer.load(std::memory_order_relaxed));
+		while (retired) {
+			Buffer *next = retired->retired_next;
+			_free_buffer(retired);
+			retired = next;
+		}
+	}
+};
@@ -37,6 +37,10 @@
 #include "core/object/script_language.h"
 #include "core/string/string_buffer.h"
 
+static _FORCE_INLINE_ bool _is_plain_string_char(char32_t p_char) {
+	return p_char != '"' && p_char != '\\' && p_char != '\n' && p_char != 0;
+}
+
 char32_t VariantParser::Stream::get_char() {
 	// is within buffer?
 	if (readahead_pointer < readahead_filled) {
@@ -278,6 +282,23 @@ Error VariantParser::get_token(Stream *p_stream, Token &r_token, int &line, Stri
 				String str;
 				char32_t prev = 0;
 				while (true) {
+					// Copy runs of plain characters straight from the read-ahead buffer.
+					uint32_t available;
+					const char32_t *buffered = p_stream->get_buffered(available);
+					uint32_t run = 0;
+					while (run < available && _is_plain_string_char(buffered[run])) {
+						run++;
+					}
+					if (run) {
+						if (prev != 0) {
+							r_err_str = "Invalid UTF-16 sequence in string, unpaired lead surrogate";
+							r_token.type = TK_ERROR;
+							return ERR_PARSE_ERROR;
+						}
+						str.append_utf32(Span(buffered, run));
+						p_stream->skip_buffered(run);
+					}
+
 					char32_t ch = p_stream->get_char();
 
 					if (ch == 0) {
@@ -478,6 +499,20 @@ Error VariantParser::get_token(Stream *p_stream, Token &r_token, int &line, Stri
 							break;
 						}
 						token_text += c;
+
+						if (reading != READING_EXP) {
+							// Take the rest of the digits in one go.
+							uint32_t available;
+							const char32_t *buffered = p_stream->get_buffered(available);
+							uint32_t run = 0;
+							while (run < available && is_digit(buffered[run])) {
+								run++;
+							}
+							if (run) {
+								token_text.append(buffered, run);
+								p_stream->skip_buffered(run);
+							}
+						}
 						c = p_stream->get_char();
 					}
 
@@ -55,6 +55,12 @@ public:
 		char32_t saved = 0;
 
 		char32_t get_char();
+		// Characters already read ahead, so the tokenizer can scan runs of them without a call per character.
+		_FORCE_INLINE_ const char32_t *get_buffered(uint32_t &r_count) const {
+			r_count = readahead_filled > readahead_pointer ? readahead_filled - readahead_pointer : 0;
+			return readahead_buffer + readahead_pointer;
+		}
+		_FORCE_INLINE_ void skip_buffered(uint32_t p_count) { readahead_pointer += p_count; }
 		virtual bool is_utf8() const = 0;
 		bool is_eof() const;
 
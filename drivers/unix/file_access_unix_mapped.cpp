@@ -0,0 +1,226 @@
+/**************************************************************************/
+/*  file_access_unix_mapped.cpp                                           */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             REDOT ENGINE                               */
+/*                        https://redotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2024-present Redot Engine contributors                   */
+/*                                          (see REDOT_AUTHORS.md)        */
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include "file_access_unix_mapped.h"
+
+#if defined(UNIX_ENABLED)
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <cerrno>
+#include <cstring>
+
+void FileAccessUnixMapped::_unmap() {
+	if (data) {
+		munmap((void *)data, length);
+		data = nullptr;
+	}
+	if (fd != -1) {
+		::close(fd);
+		fd = -1;
+	}
+	length = 0;
+	opened = false;
+}
+
+Error FileAccessUnixMapped::open_internal(const String &p_path, int p_mode_flags) {
+	_unmap();
+
+	ERR_FAIL_COND_V_MSG(p_mode_flags != READ, ERR_UNAVAILABLE, "Memory-mapped files can only be opened for reading.");
+
+	path_src = p_path;
+	path = fix_path(p_path);
+
+	fd = ::open(path.utf8().get_data(), O_RDONLY | O_CLOEXEC);
+	if (fd == -1) {
+		return errno == ENOENT ? ERR_FILE_NOT_FOUND : ERR_FILE_CANT_OPEN;
+	}
+
+	struct stat st = {};
+	if (fstat(fd, &st) != 0 || !S_ISREG(st.st_mode)) {
+		_unmap();
+		return ERR_FILE_CANT_OPEN;
+	}
+
+	if (st.st_size > 0) {
+		void *mapping = mmap(nullptr, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+		if (mapping == MAP_FAILED) {
+			_unmap();
+			return ERR_FILE_CANT_OPEN;
+		}
+		data = (const uint8_t *)mapping;
+		length = st.st_size;
+	}
+
+	// The descriptor is kept open to map views (see `get_mapped_view()`).
+
+	opened = true;
+	pos = 0;
+	eof = false;
+	return OK;
+}
+
+bool FileAccessUnixMapped::is_open() const {
+	return opened;
+}
+
+String FileAccessUnixMapped::get_path() const {
+	return path_src;
+}
+
+String FileAccessUnixMapped::get_path_absolute() const {
+	return path;
+}
+
+void FileAccessUnixMapped::seek(uint64_t p_position) {
+	ERR_FAIL_COND_MSG(!opened, "File must be opened before use.");
+
+	pos = p_position;
+	eof = false;
+}
+
+void FileAccessUnixMapped::seek_end(int64_t p_position) {
+	ERR_FAIL_COND_MSG(!opened, "File must be opened before use.");
+
+	pos = length + p_position;
+	eof = false;
+}
+
+uint64_t FileAccessUnixMapped::get_position() const {
+	return pos;
+}
+
+uint64_t FileAccessUnixMapped::get_length() const {
+	return length;
+}
+
+bool FileAccessUnixMapped::eof_reached() const {
+	return eof;
+}
+
+uint64_t FileAccessUnixMapped::get_buffer(uint8_t *p_dst, uint64_t p_length) const {
+	ERR_FAIL_COND_V_MSG(!opened, -1, "File must be opened before use.");
+	ERR_FAIL_COND_V(!p_dst && p_length > 0, -1);
+
+	uint64_t to_read = p_length;
+	if (pos >= length) {
+		to_read = 0;
+	} else if (to_read > length - pos) {
+		to_read = length - pos;
+	}
+	if (to_read < p_length) {
+		eof = true;
+	}
+
+	if (to_read > 0) {
+		memcpy(p_dst, data + pos, to_read);
+		pos += to_read;
+	}
+	return to_read;
+}
+
+// Each view gets its own mapping, preceded by one page holding the header expected by CowData.
+// The total size of the mapping is stored at its start, so it can be unmapped from the data pointer.
+Vector<uint8_t> FileAccessUnixMapped::get_mapped_view(uint64_t p_offset, uint64_t p_length) const {
+	Vector<uint8_t> view;
+	// CowData needs its size and reference count to be aligned right before the data.
+	if (fd == -1 || p_length < MIN_VIEW_SIZE || p_offset % sizeof(uint64_t) != 0 || p_offset + p_length > length) {
+		return view;
+	}
+
+	const uint64_t page_size = sysconf(_SC_PAGESIZE);
+	const uint64_t file_offset = p_offset - p_offset % page_size;
+	const uint64_t map_length = p_offset + p_length - file_offset;
+	const uint64_t total_length = page_size + map_length;
+
+	uint8_t *base = (uint8_t *)mmap(nullptr, total_length, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+	if (base == MAP_FAILED) {
+		return view;
+	}
+	// Writable so CowData can update the header, which shares the first page with the data when it isn't page aligned.
+	// Being private, writes never reach the file.
+	if (mmap(base + page_size, map_length, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_FIXED, fd, file_offset) == MAP_FAILED) {
+		munmap(base, total_length);
+		return view;
+	}
+	*(uint64_t *)base = total_length;
+
+	uint8_t *view_data = base + page_size + (p_offset - file_offset);
+	view.set_external(view_data, p_length);
+	return view;
+}
+
+void FileAccessUnixMapped::prefetch(uint64_t p_offset, uint64_t p_length) const {
+	if (!data || p_offset >= length) {
+		return;
+	}
+
+	const uint64_t page_size = sysconf(_SC_PAGESIZE);
+	const uint64_t start = p_offset - p_offset % page_size;
+	const uint64_t end = MIN(p_offset + p_length, length);
+	madvise((void *)(data + start), end - start, MADV_WILLNEED);
+}
+
+void FileAccessUnixMapped::_free_view(void *p_data) {
+	const uintptr_t page_size = sysconf(_SC_PAGESIZE);
+	// Data always starts in the first page of the file mapping, right after the page holding the size.
+	uint8_t *base = (uint8_t *)(((uintptr_t)p_data & ~(page_size - 1)) - page_size);
+	munmap(base, *(uint64_t *)base);
+}
+
+void FileAccessUnixMapped::initialize() {
+	cowdata_external_free_func = &_free_view;
+}
+
+Error FileAccessUnixMapped::get_error() const {
+	return eof ? ERR_FILE_EOF : OK;
+}
+
+void FileAccessUnixMapped::flush() {
+	ERR_FAIL_MSG("Memory-mapped files are read-only.");
+}
+
+bool FileAccessUnixMapped::store_buffer(const uint8_t *p_src, uint64_t p_length) {
+	ERR_FAIL_V_MSG(false, "Memory-mapped files are read-only.");
+}
+
+void FileAccessUnixMapped::close() {
+	_unmap();
+}
+
+FileAccessUnixMapped::~FileAccessUnixMapped() {
+	_unmap();
+}
+
+#endif // UNIX_ENABLED
@@ -36,6 +36,7 @@
 #include "core/core_globals.h"
 #include "core/crypto/crypto.h"
 #include "core/debugger/engine_debugger.h"
+#include "core/debugger/trace_profiler.h"
 #include "core/extension/extension_api_dump.h"
 #include "core/extension/gdextension_interface_dump.gen.h"
 #include "core/extension/gdextension_manager.h"
@@ -630,6 +631,9 @@ void Main::print_help(const char *p_binary) {
 	print_help_option("-b, --breakpoints", "Breakpoint list as source::line comma-separated pairs, no spaces (use %%20 instead).\n");
 	print_help_option("--ignore-error-breaks", "If debugger is connected, prevents sending error breakpoints.\n");
 	print_help_option("--profiling", "Enable profiling in the script debugger.\n");
+#ifdef TRACE_PROFILER_ENABLED
+	print_help_option("--profile-trace <file>", "Record the engine's profiling zones and save them to a given file in the Chrome trace event format when quitting.\n");
+#endif
 	print_help_option("--gpu-profile", "Show a GPU profile of the tasks that took the most time during frame rendering.\n");
 	print_help_option("--gpu-validation", "Enable graphics API validation layers for debugging.\n");
 #ifdef DEBUG_ENABLED
@@ -1833,6 +1837,16 @@ Error Main::setup(const char *execpath, int argc, char *argv[], bool p_second_ph
 				goto error;
 			}
 #endif // XR_DISABLED
+#ifdef TRACE_PROFILER_ENABLED
+		} else if (arg == "--profile-trace") {
+			if (N) {
+				TraceProfiler::start(N->get());
+				N = N->next();
+			} else {
+				OS::get_singleton()->print("Missing <file> argument for --profile-trace <file>.\n");
+				goto error;
+			}
+#endif
 		} else if (arg == "--benchmark") {
 			OS::get_singleton()->set_use_benchmark(true);
 		} else if (arg == "--benchmark-file") {
@@ -4504,10 +4518,17 @@ int Main::start() {
 
 			if (!game_path.is_empty()) {
 				Node *scene = nullptr;
+				const bool prefetch_dependencies = GLOBAL_GET("application/run/prefetch_main_scene_dependencies");
+				if (prefetch_dependencies) {
+					ResourceLoader::prefetch_dependencies_begin(local_game_path);
+				}
 				Ref<PackedScene> scenedata = ResourceLoader::load(local_game_path);
 				if (scenedata.is_valid()) {
 					scene = scenedata->instantiate();
 				}
+				if (prefetch_dependencies) {
+					ResourceLoader::prefetch_dependencies_end();
+				}
 
 				ERR_FAIL_NULL_V_MSG(scene, EXIT_FAILURE, "Failed loading scene: " + local_game_path + ".");
 				sml->add_current_scene(scene);
@@ -4914,8 +4935,14 @@ void Main::cleanup(bool p_force) {
 		movie_writer->end();
 	}
 
+	ResourceSaver::clear_thread_save_tasks();
 	ResourceLoader::clear_thread_load_tasks();
 
+#ifdef TRACE_PROFILER_ENABLED
+	// The trace is written once the worker threads have exited, see `unregister_core_types()`.
+	TraceProfiler::stop();
+#endif
+
 	ResourceLoader::remove_custom_loaders();
 	ResourceSaver::remove_custom_savers();
 	PropertyListHelper::clear_base_helpers();
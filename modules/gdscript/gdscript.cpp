@@ -777,6 +777,8 @@ Error GDScript::reload(bool p_keep_state) {
 	}
 #endif
 
+	// The cache may have already parsed this exact source to resolve other scripts' dependencies.
+	Ref<GDScriptParserRef> cached_parser_ref;
 	{
 		String source_path = path;
 		if (source_path.is_empty()) {
@@ -799,6 +801,8 @@ Error GDScript::reload(bool p_keep_state) {
 					}
 					if (parser_ref->get_source_hash() != source_hash) {
 						GDScriptCache::remove_parser(source_path);
+					} else if (parser_ref->get_status() != GDScriptParserRef::EMPTY) {
+						cached_parser_ref = parser_ref;
 					}
 				}
 			}
@@ -814,44 +818,51 @@ Error GDScript::reload(bool p_keep_state) {
 #endif
 
 	valid = false;
-	GDScriptParser parser;
+	GDScriptParser own_parser;
+	GDScriptParser *parser = &own_parser;
 	Error err;
-	if (!binary_tokens.is_empty()) {
-		err = parser.parse_binary(binary_tokens, path);
+	// Reuse the cached parse and analysis when they succeeded, instead of doing both again.
+	// On failure, parse again so errors are reported the same way as before.
+	if (cached_parser_ref.is_valid() && cached_parser_ref->raise_status(GDScriptParserRef::FULLY_SOLVED) == OK && cached_parser_ref->get_analyzer()->resolve_dependencies() == OK) {
+		parser = cached_parser_ref->get_parser();
 	} else {
-		err = parser.parse(source, path, false);
-	}
-	if (err) {
-		if (EngineDebugger::is_active()) {
-			GDScriptLanguage::get_singleton()->debug_break_parse(_get_debug_path(), parser.get_errors().front()->get().line, "Parser Error: " + parser.get_errors().front()->get().message);
+		if (!binary_tokens.is_empty()) {
+			err = parser->parse_binary(binary_tokens, path);
+		} else {
+			err = parser->parse(source, path, false);
+		}
+		if (err) {
+			if (EngineDebugger::is_active()) {
+				GDScriptLanguage::get_singleton()->debug_break_parse(_get_debug_path(), parser->get_errors().front()->get().line, "Parser Error: " + parser->get_errors().front()->get().message);
+			}
+			// TODO: Show all error messages.
+			_err_print_error("GDScript::reload", path.is_empty() ? "built-in" : (const char *)path.utf8().get_data(), parser->get_errors().front()->get().line, ("Parse Error: " + parser->get_errors().front()->get().message).utf8().get_data(), false, ERR_HANDLER_SCRIPT);
+			reloading = false;
+			return ERR_PARSE_ERROR;
 		}
-		// TODO: Show all error messages.
-		_err_print_error("GDScript::reload", path.is_empty() ? "built-in" : (const char *)path.utf8().get_data(), parser.get_errors().front()->get().line, ("Parse Error: " + parser.get_errors().front()->get().message).utf8().get_data(), false, ERR_HANDLER_SCRIPT);
-		reloading = false;
-		return ERR_PARSE_ERROR;
-	}
 
-	GDScriptAnalyzer analyzer(&parser);
-	err = analyzer.analyze();
+		GDScriptAnalyzer analyzer(parser);
+		err = analyzer.analyze();
 
-	if (err) {
-		if (EngineDebugger::is_active()) {
-			GDScriptLanguage::get_singleton()->debug_break_parse(_get_debug_path(), parser.get_errors().front()->get().line, "Parser Error: " + parser.get_errors().front()->get().message);
-		}
+		if (err) {
+			if (EngineDebugger::is_active()) {
+				GDScriptLanguage::get_singleton()->debug_break_parse(_get_debug_path(), parser->get_errors().front()->get().line, "Parser Error: " + parser->get_errors().front()->get().message);
+			}
 
-		const List<GDScriptParser::ParserError>::Element *e = parser.get_errors().front();
-		while (e != nullptr) {
-			_err_print_error("GDScript::reload", path.is_empty() ? "built-in" : (const char *)path.utf8().get_data(), e->get().line, ("Parse Error: " + e->get().message).utf8().get_data(), false, ERR_HANDLER_SCRIPT);
-			e = e->next();
+			const List<GDScriptParser::ParserError>::Element *e = parser->get_errors().front();
+			while (e != nullptr) {
+				_err_print_error("GDScript::reload", path.is_empty() ? "built-in" : (const char *)path.utf8().get_data(), e->get().line, ("Parse Error: " + e->get().message).utf8().get_data(), false, ERR_HANDLER_SCRIPT);
+				e = e->next();
+			}
+			reloading = false;
+			return ERR_PARSE_ERROR;
 		}
-		reloading = false;
-		return ERR_PARSE_ERROR;
 	}
 
-	can_run = ScriptServer::is_scripting_enabled() || parser.is_tool();
+	can_run = ScriptServer::is_scripting_enabled() || parser->is_tool();
 
 	GDScriptCompiler compiler;
-	err = compiler.compile(&parser, this, p_keep_state);
+	err = compiler.compile(parser, this, p_keep_state);
 
 	if (err) {
 		_err_print_error("GDScript::reload", path.is_empty() ? "built-in" : (const char *)path.utf8().get_data(), compiler.get_error_line(), ("Compile Error: " + compiler.get_error()).utf8().get_data(), false, ERR_HANDLER_SCRIPT);
@@ -870,11 +881,11 @@ Error GDScript::reload(bool p_keep_state) {
 #ifdef TOOLS_ENABLED
 	// Done after compilation because it needs the GDScript object's inner class GDScript objects,
 	// which are made by calling make_scripts() within compiler.compile() above.
-	GDScriptDocGen::generate_docs(this, parser.get_tree());
+	GDScriptDocGen::generate_docs(this, parser->get_tree());
 #endif
 
 #ifdef DEBUG_ENABLED
-	for (const GDScriptWarning &warning : parser.get_warnings()) {
+	for (const GDScriptWarning &warning : parser->get_warnings()) {
 		if (EngineDebugger::is_active()) {
 			Vector<ScriptLanguage::StackInfo> si;
 			EngineDebugger::get_script_debugger()->send_error("", get_script_path(), warning.start_line, warning.get_name(), warning.get_message(), false, ERR_HANDLER_WARNING, si);
@@ -1652,6 +1663,9 @@ GDScript::~GDScript() {
 	}
 	destructing = true;
 
+	// The address of this script may be reused by another one.
+	GDScriptFunction::invalidate_inline_caches();
+
 	if (is_print_verbose_enabled()) {
 		MutexLock lock(func_ptrs_to_update_mutex);
 		if (!func_ptrs_to_update.is_empty()) {
@@ -2288,6 +2302,24 @@ void GDScriptLanguage::init() {
 	}
 #endif
 
+	if (GLOBAL_GET("application/run/parse_scripts_in_parallel") && WorkerThreadPool::get_singleton()) {
+		// Autoloads and named classes are the scripts most likely to be needed, so parse them up front.
+		Vector<String> paths;
+		for (const KeyValue<StringName, ProjectSettings::AutoloadInfo> &E : ProjectSettings::get_singleton()->get_autoload_list()) {
+			if (E.value.path.get_extension() == "gd") {
+				paths.push_back(E.value.path);
+			}
+		}
+		List<StringName> global_classes;
+		ScriptServer::get_global_class_list(&global_classes);
+		for (const StringName &class_name : global_classes) {
+			if (ScriptServer::get_global_class_language(class_name) == get_name()) {
+				paths.push_back(ScriptServer::get_global_class_path(class_name));
+			}
+		}
+		GDScriptCache::parse_scripts_in_parallel(paths);
+	}
+
 #ifdef TESTS_ENABLED
 	GDScriptTests::GDScriptTestRunner::handle_cmdline();
 #endif
@@ -2950,6 +2982,7 @@ GDScriptLanguage::GDScriptLanguage() {
 	_debug_max_call_stack = GLOBAL_DEF_RST(PropertyInfo(Variant::INT, "debug/settings/gdscript/max_call_stack", PROPERTY_HINT_RANGE, "512," + itos(GDScriptFunction::MAX_CALL_DEPTH - 1) + ",1"), 1024);
 	track_call_stack = GLOBAL_DEF_RST("debug/settings/gdscript/always_track_call_stacks", false);
 	track_locals = GLOBAL_DEF_RST("debug/settings/gdscript/always_track_local_variables", false);
+	GLOBAL_DEF_RST("application/run/parse_scripts_in_parallel", false);
 
 #ifdef DEBUG_ENABLED
 	track_call_stack = true;
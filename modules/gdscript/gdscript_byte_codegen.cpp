@@ -394,6 +394,14 @@ GDScriptFunction *GDScriptByteCodeGenerator::write_end() {
 		function->_lambdas_count = 0;
 	}
 
+	if (inline_cache_count) {
+		function->_inline_caches_ptr = memnew_arr(GDScriptFunction::InlineCache, inline_cache_count);
+		function->_inline_caches_count = inline_cache_count;
+	} else {
+		function->_inline_caches_ptr = nullptr;
+		function->_inline_caches_count = 0;
+	}
+
 	if (GDScriptLanguage::get_singleton()->should_track_locals()) {
 		function->stack_debug = stack_debug;
 	}
@@ -553,6 +561,72 @@ void GDScriptByteCodeGenerator::write_type_adjust(const Address &p_target, Varia
 	append(p_target);
 }
 
+// Operators with a dedicated opcode, which work on the operand payloads directly.
+static GDScriptFunction::Opcode get_typed_operator_opcode(Variant::Operator p_operator, Variant::Type p_left_type, Variant::Type p_right_type) {
+#define TYPED_OPERATOR(m_left_type, m_right_type, m_opcode)                             \
+	if (p_left_type == Variant::m_left_type && p_right_type == Variant::m_right_type) { \
+		return GDScriptFunction::OPCODE_OPERATOR_##m_opcode;                            \
+	}
+
+	switch (p_operator) {
+		case Variant::OP_ADD:
+			TYPED_OPERATOR(INT, INT, ADD_INT);
+			TYPED_OPERATOR(FLOAT, FLOAT, ADD_FLOAT);
+			TYPED_OPERATOR(VECTOR2, VECTOR2, ADD_VECTOR2);
+			TYPED_OPERATOR(VECTOR3, VECTOR3, ADD_VECTOR3);
+			break;
+		case Variant::OP_SUBTRACT:
+			TYPED_OPERATOR(INT, INT, SUBTRACT_INT);
+			TYPED_OPERATOR(FLOAT, FLOAT, SUBTRACT_FLOAT);
+			TYPED_OPERATOR(VECTOR2, VECTOR2, SUBTRACT_VECTOR2);
+			TYPED_OPERATOR(VECTOR3, VECTOR3, SUBTRACT_VECTOR3);
+			break;
+		case Variant::OP_MULTIPLY:
+			TYPED_OPERATOR(INT, INT, MULTIPLY_INT);
+			TYPED_OPERATOR(FLOAT, FLOAT, MULTIPLY_FLOAT);
+			TYPED_OPERATOR(VECTOR2, VECTOR2, MULTIPLY_VECTOR2);
+			TYPED_OPERATOR(VECTOR2, FLOAT, MULTIPLY_VECTOR2_FLOAT);
+			TYPED_OPERATOR(VECTOR3, VECTOR3, MULTIPLY_VECTOR3);
+			TYPED_OPERATOR(VECTOR3, FLOAT, MULTIPLY_VECTOR3_FLOAT);
+			break;
+		case Variant::OP_EQUAL:
+			TYPED_OPERATOR(INT, INT, EQUAL_INT);
+			TYPED_OPERATOR(FLOAT, FLOAT, EQUAL_FLOAT);
+			break;
+		case Variant::OP_NOT_EQUAL:
+			TYPED_OPERATOR(INT, INT, NOT_EQUAL_INT);
+			TYPED_OPERATOR(FLOAT, FLOAT, NOT_EQUAL_FLOAT);
+			break;
+		case Variant::OP_LESS:
+			TYPED_OPERATOR(INT, INT, LESS_INT);
+			TYPED_OPERATOR(FLOAT, FLOAT, LESS_FLOAT);
+			break;
+		case Variant::OP_LESS_EQUAL:
+			TYPED_OPERATOR(INT, INT, LESS_EQUAL_INT);
+			TYPED_OPERATOR(FLOAT, FLOAT, LESS_EQUAL_FLOAT);
+			break;
+		case Variant::OP_GREATER:
+			TYPED_OPERATOR(INT, INT, GREATER_INT);
+			TYPED_OPERATOR(FLOAT, FLOAT, GREATER_FLOAT);
+			break;
+		case Variant::OP_GREATER_EQUAL:
+			TYPED_OPERATOR(INT, INT, GREATER_EQUAL_INT);
+			TYPED_OPERATOR(FLOAT, FLOAT, GREATER_EQUAL_FLOAT);
+			break;
+		case Variant::OP_DIVIDE:
+			TYPED_OPERATOR(FLOAT, FLOAT, DIVIDE_FLOAT);
+			TYPED_OPERATOR(VECTOR2, FLOAT, DIVIDE_VECTOR2_FLOAT);
+			TYPED_OPERATOR(VECTOR3, FLOAT, DIVIDE_VECTOR3_FLOAT);
+			break;
+		default:
+			break;
+	}
+
+#undef TYPED_OPERATOR
+
+	return GDScriptFunction::OPCODE_END;
+}
+
 void GDScriptByteCodeGenerator::write_unary_operator(const Address &p_target, Variant::Operator p_operator, const Address &p_left_operand) {
 	if (HAS_BUILTIN_TYPE(p_left_operand)) {
 		// Gather specific operator.
@@ -611,6 +685,19 @@ void GDScriptByteCodeGenerator::write_binary_operator(const Address &p_target, V
 			}
 		}
 
+		GDScriptFunction::Opcode typed_opcode = get_typed_operator_opcode(p_operator, p_left_operand.type.builtin_type, p_right_operand.type.builtin_type);
+		if (typed_opcode != GDScriptFunction::OPCODE_END) {
+			if (Variant::get_operator_return_type(p_operator, p_left_operand.type.builtin_type, p_right_operand.type.builtin_type) == Variant::BOOL) {
+				last_typed_comparison_pos = opcodes.size();
+				last_typed_comparison_target = p_target;
+			}
+			append_opcode(typed_opcode);
+			append(p_left_operand);
+			append(p_right_operand);
+			append(p_target);
+			return;
+		}
+
 		// Gather specific operator.
 		Variant::ValidatedOperatorEvaluator op_func = Variant::get_validated_operator_evaluator(p_operator, p_left_operand.type.builtin_type, p_right_operand.type.builtin_type);
 
@@ -692,15 +779,13 @@ void GDScriptByteCodeGenerator::write_type_test(const Address &p_target, const A
 }
 
 void GDScriptByteCodeGenerator::write_and_left_operand(const Address &p_left_operand) {
-	append_opcode(GDScriptFunction::OPCODE_JUMP_IF_NOT);
-	append(p_left_operand);
+	append_jump_if_not(p_left_operand);
 	logic_op_jump_pos1.push_back(opcodes.size());
 	append(0); // Jump target, will be patched.
 }
 
 void GDScriptByteCodeGenerator::write_and_right_operand(const Address &p_right_operand) {
-	append_opcode(GDScriptFunction::OPCODE_JUMP_IF_NOT);
-	append(p_right_operand);
+	append_jump_if_not(p_right_operand);
 	logic_op_jump_pos2.push_back(opcodes.size());
 	append(0); // Jump target, will be patched.
 }
@@ -756,8 +841,7 @@ void GDScriptByteCodeGenerator::write_start_ternary(const Address &p_target) {
 }
 
 void GDScriptByteCodeGenerator::write_ternary_condition(const Address &p_condition) {
-	append_opcode(GDScriptFunction::OPCODE_JUMP_IF_NOT);
-	append(p_condition);
+	append_jump_if_not(p_condition);
 	ternary_jump_fail_pos.push_back(opcodes.size());
 	append(0); // Jump target, will be patched.
 }
@@ -860,6 +944,7 @@ void GDScriptByteCodeGenerator::write_set_named(const Address &p_target, const S
 	append(p_target);
 	append(p_source);
 	append(p_name);
+	append_inline_cache();
 }
 
 void GDScriptByteCodeGenerator::write_get_named(const Address &p_target, const StringName &p_name, const Address &p_source) {
@@ -878,6 +963,7 @@ void GDScriptByteCodeGenerator::write_get_named(const Address &p_target, const S
 	append(p_source);
 	append(p_target);
 	append(p_name);
+	append_inline_cache();
 }
 
 void GDScriptByteCodeGenerator::write_set_member(const Address &p_value, const StringName &p_name) {
@@ -1092,6 +1178,7 @@ void GDScriptByteCodeGenerator::write_call(const Address &p_target, const Addres
 	append(ct.target);
 	append(p_arguments.size());
 	append(p_function_name);
+	append_inline_cache();
 	ct.cleanup();
 }
 
@@ -1117,6 +1204,7 @@ void GDScriptByteCodeGenerator::write_call_async(const Address &p_target, const
 	append(ct.target);
 	append(p_arguments.size());
 	append(p_function_name);
+	append_inline_cache();
 	ct.cleanup();
 }
 
@@ -1351,6 +1439,7 @@ void GDScriptByteCodeGenerator::write_call_self(const Address &p_target, const S
 	append(ct.target);
 	append(p_arguments.size());
 	append(p_function_name);
+	append_inline_cache();
 	ct.cleanup();
 }
 
@@ -1364,6 +1453,7 @@ void GDScriptByteCodeGenerator::write_call_self_async(const Address &p_target, c
 	append(ct.target);
 	append(p_arguments.size());
 	append(p_function_name);
+	append_inline_cache();
 	ct.cleanup();
 }
 
@@ -1377,6 +1467,7 @@ void GDScriptByteCodeGenerator::write_call_script_function(const Address &p_targ
 	append(ct.target);
 	append(p_arguments.size());
 	append(p_function_name);
+	append_inline_cache();
 	ct.cleanup();
 }
 
@@ -1511,8 +1602,7 @@ void GDScriptByteCodeGenerator::write_await(const Address &p_target, const Addre
 }
 
 void GDScriptByteCodeGenerator::write_if(const Address &p_condition) {
-	append_opcode(GDScriptFunction::OPCODE_JUMP_IF_NOT);
-	append(p_condition);
+	append_jump_if_not(p_condition);
 	if_jmp_addrs.push_back(opcodes.size());
 	append(0); // Jump destination, will be patched.
 }
@@ -1722,8 +1812,7 @@ void GDScriptByteCodeGenerator::start_while_condition() {
 
 void GDScriptByteCodeGenerator::write_while(const Address &p_condition) {
 	// Condition check.
-	append_opcode(GDScriptFunction::OPCODE_JUMP_IF_NOT);
-	append(p_condition);
+	append_jump_if_not(p_condition);
 	while_jmp_addrs.push_back(opcodes.size());
 	append(0); // End of loop address, will be patched.
 }
@@ -159,6 +159,13 @@ class GDScriptByteCodeGenerator : public GDScriptCodeGenerator {
 
 	List<List<int>> current_breaks_to_patch;
 
+	// Last typed comparison written, so a branch right after it can be fused with it on tier-up.
+	int last_typed_comparison_pos = -1;
+	Address last_typed_comparison_target;
+
+	// Named gets, named sets and dynamic calls each get their own inline cache in the function.
+	int inline_cache_count = 0;
+
 	void add_stack_identifier(const StringName &p_id, int p_stackpos) {
 		if (locals.size() > max_locals) {
 			max_locals = locals.size();
@@ -384,10 +391,22 @@ class GDScriptByteCodeGenerator : public GDScriptCodeGenerator {
 		instr_args_max = MAX(instr_args_max, p_argument_count);
 	}
 
+	void append_jump_if_not(const Address &p_condition) {
+		if (last_typed_comparison_pos >= 0 && last_typed_comparison_pos + 4 == opcodes.size() && last_typed_comparison_target.mode == p_condition.mode && last_typed_comparison_target.address == p_condition.address) {
+			function->tier_up_branches.push_back(last_typed_comparison_pos);
+		}
+		append_opcode(GDScriptFunction::OPCODE_JUMP_IF_NOT);
+		append(p_condition);
+	}
+
 	void append(int p_code) {
 		opcodes.push_back(p_code);
 	}
 
+	void append_inline_cache() {
+		opcodes.push_back(inline_cache_count++);
+	}
+
 	void append(const Address &p_address) {
 		opcodes.push_back(address_of(p_address));
 	}
@@ -79,7 +79,15 @@ Error GDScriptParserRef::raise_status(Status p_new_status) {
 				status = PARSED;
 				String remapped_path = ResourceLoader::path_remap(path);
 				if (remapped_path.get_extension().to_lower() == "gdc") {
-					Vector<uint8_t> tokens = GDScriptCache::get_binary_tokens(remapped_path);
+					// Take the tokens already loaded for the script, instead of reading the file again.
+					Vector<uint8_t> tokens;
+					Ref<GDScript> script = GDScriptCache::get_cached_script(path);
+					if (script.is_valid()) {
+						tokens = script->get_binary_tokens_source();
+					}
+					if (tokens.is_empty()) {
+						tokens = GDScriptCache::get_binary_tokens(remapped_path);
+					}
 					source_hash = hash_djb2_buffer(tokens.ptr(), tokens.size());
 					result = get_parser()->parse_binary(tokens, path);
 				} else {
@@ -252,6 +260,7 @@ void GDScriptCache::remove_parser(const String &p_path) {
 		parser_ref->abandoned = true;
 		singleton->abandoned_parser_map[p_path].push_back(parser_ref->get_instance_id());
 	}
+	singleton->prepared_parsers.erase(p_path);
 
 	// Can't clear the parser because some other parser might be currently using it in the chain of calls.
 	singleton->parser_map.erase(p_path);
@@ -329,17 +338,21 @@ Ref<GDScript> GDScriptCache::get_shallow_script(const String &p_path, Error &r_e
 		return Ref<GDScript>(); // Returns null and does not cache when the script fails to load.
 	}
 
+	// Cached before parsing, so the parser can take the binary tokens that were just loaded.
+	singleton->shallow_gdscript_cache[p_path] = script;
+
 	Ref<GDScriptParserRef> parser_ref = get_parser(p_path, GDScriptParserRef::PARSED, r_error);
 	if (r_error == OK) {
 		GDScriptCompiler::make_scripts(script.ptr(), parser_ref->get_parser()->get_tree(), true);
 	}
 
-	singleton->shallow_gdscript_cache[p_path] = script;
-
 	return script;
 }
 
 Ref<GDScript> GDScriptCache::get_full_script(const String &p_path, Error &r_error, const String &p_owner, bool p_update_from_disk) {
+	// Dependencies are analyzed from the prepared parsers, so they have to be ready.
+	_wait_for_parallel_parse();
+
 	MutexLock lock(singleton->mutex);
 
 	if (!p_owner.is_empty()) {
@@ -392,6 +405,7 @@ Ref<GDScript> GDScriptCache::get_full_script(const String &p_path, Error &r_erro
 
 	singleton->full_gdscript_cache[p_path] = script;
 	singleton->shallow_gdscript_cache.erase(p_path);
+	singleton->prepared_parsers.erase(p_path);
 
 	return script;
 }
@@ -446,11 +460,90 @@ void GDScriptCache::remove_static_script(const String &p_fqcn) {
 	singleton->static_gdscript_cache.erase(p_fqcn);
 }
 
+void GDScriptCache::parse_scripts_in_parallel(const Vector<String> &p_paths) {
+	ERR_FAIL_NULL(singleton);
+	ERR_FAIL_NULL(WorkerThreadPool::get_singleton());
+	_wait_for_parallel_parse();
+
+	{
+		MutexLock lock(singleton->mutex);
+		singleton->parallel_parse_paths.clear();
+		for (const String &path : p_paths) {
+			if (!singleton->parser_map.has(path) && !singleton->full_gdscript_cache.has(path)) {
+				singleton->parallel_parse_paths.push_back(path);
+			}
+		}
+	}
+	if (singleton->parallel_parse_paths.is_empty()) {
+		return;
+	}
+
+	// Fill the parser's lazily built static tables here, so worker threads only read them.
+	{
+		GDScriptParser parser;
+		GDScriptParser::get_builtin_type(StringName());
+	}
+
+	// Parsing only depends on the script itself. Analysis and compilation still happen on demand,
+	// in the same order as before, and start from the prepared parsers.
+	// High priority, since loading the first script waits for it.
+	const WorkerThreadPool::GroupID group = WorkerThreadPool::get_singleton()->add_template_group_task(singleton, &GDScriptCache::_parse_script_in_parallel, singleton->parallel_parse_paths.ptr(), singleton->parallel_parse_paths.size(), -1, true, SNAME("GDScriptParallelParse"));
+	MutexLock lock(singleton->mutex);
+	singleton->parallel_parse_group = group;
+}
+
+bool GDScriptCache::has_prepared_parser(const String &p_path) {
+	_wait_for_parallel_parse();
+	MutexLock lock(singleton->mutex);
+	return singleton->prepared_parsers.has(p_path);
+}
+
+void GDScriptCache::_parse_script_in_parallel(uint32_t p_index, const String *p_paths) {
+	const String &path = p_paths[p_index];
+
+	Ref<GDScriptParserRef> parser_ref;
+	parser_ref.instantiate();
+	parser_ref->path = path;
+	// Not in the parser map yet, so it must not remove another parser with the same path when freed.
+	parser_ref->abandoned = true;
+
+	if (parser_ref->raise_status(GDScriptParserRef::PARSED) != OK) {
+		// Parsed again when the script is loaded, which reports the errors.
+		return;
+	}
+
+	MutexLock lock(mutex);
+	if (cleared || parser_map.has(path)) {
+		return;
+	}
+	parser_ref->abandoned = false;
+	parser_map[path] = parser_ref.ptr();
+	prepared_parsers[path] = parser_ref;
+}
+
+void GDScriptCache::_wait_for_parallel_parse() {
+	MutexLock lock(singleton->mutex);
+	if (singleton->parallel_parse_group == -1) {
+		return;
+	}
+
+	// Claimed under the lock, since a group can only be waited for once.
+	const WorkerThreadPool::GroupID group = singleton->parallel_parse_group;
+	singleton->parallel_parse_group = -1;
+
+	// The parse tasks lock the cache when they finish, and this may be called with it locked.
+	uint32_t allowance_id = WorkerThreadPool::thread_enter_unlock_allowance_zone(singleton->mutex);
+	WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group);
+	WorkerThreadPool::thread_exit_unlock_allowance_zone(allowance_id);
+}
+
 void GDScriptCache::clear() {
 	if (singleton == nullptr) {
 		return;
 	}
 
+	_wait_for_parallel_parse();
+
 	MutexLock lock(singleton->mutex);
 
 	if (singleton->cleared) {
@@ -485,6 +578,7 @@ void GDScriptCache::clear() {
 	}
 
 	parser_map_refs.clear();
+	singleton->prepared_parsers.clear();
 	singleton->shallow_gdscript_cache.clear();
 	singleton->full_gdscript_cache.clear();
 	singleton->static_gdscript_cache.clear();
@@ -35,6 +35,7 @@
 #include "gdscript.h"
 
 #include "core/object/ref_counted.h"
+#include "core/object/worker_thread_pool.h"
 #include "core/os/safe_binary_mutex.h"
 #include "core/templates/hash_map.h"
 #include "core/templates/hash_set.h"
@@ -90,6 +91,14 @@ class GDScriptCache {
 	HashMap<String, HashSet<String>> dependencies;
 	HashMap<String, HashSet<String>> parser_inverse_dependencies;
 
+	// Parsers prepared on worker threads by parse_scripts_in_parallel(), held until their script is compiled.
+	HashMap<String, Ref<GDScriptParserRef>> prepared_parsers;
+	Vector<String> parallel_parse_paths;
+	WorkerThreadPool::GroupID parallel_parse_group = -1;
+
+	void _parse_script_in_parallel(uint32_t p_index, const String *p_paths);
+	static void _wait_for_parallel_parse();
+
 	friend class GDScript;
 	friend class GDScriptParserRef;
 	friend class GDScriptInstance;
@@ -118,6 +127,8 @@ public:
 	static Ref<GDScript> get_cached_script(const String &p_path);
 	static Error finish_compiling(const String &p_owner);
 	static void add_static_script(Ref<GDScript> p_script);
+	static void parse_scripts_in_parallel(const Vector<String> &p_paths);
+	static bool has_prepared_parser(const String &p_path);
 	static void remove_static_script(const String &p_fqcn);
 
 	static void clear();
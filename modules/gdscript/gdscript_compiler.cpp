@@ -3261,6 +3261,9 @@ Error GDScriptCompiler::compile(const GDScriptParser *p_parser, GDScript *p_scri
 
 	ScriptLambdaInfo old_lambda_info = _get_script_lambda_replacement_info(p_script);
 
+	// Member layouts and functions are about to change.
+	GDScriptFunction::invalidate_inline_caches();
+
 	// Create scripts for subclasses beforehand so they can be referenced
 	make_scripts(p_script, root, p_keep_state);
 
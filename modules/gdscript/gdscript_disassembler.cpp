@@ -143,6 +143,72 @@ void GDScriptFunction::disassemble(const Vector<String> &p_code_lines) const {
 
 				incr += 5;
 			} break;
+#define DISASSEMBLE_OPERATOR_TYPED(m_name, m_op) \
+	case OPCODE_OPERATOR_##m_name: {             \
+		text += "typed operator ";               \
+		text += DADDR(3);                        \
+		text += " = ";                           \
+		text += DADDR(1);                        \
+		text += " " #m_op " ";                   \
+		text += DADDR(2);                        \
+		incr += 4;                               \
+	} break
+
+				DISASSEMBLE_OPERATOR_TYPED(ADD_INT, +);
+				DISASSEMBLE_OPERATOR_TYPED(SUBTRACT_INT, -);
+				DISASSEMBLE_OPERATOR_TYPED(MULTIPLY_INT, *);
+				DISASSEMBLE_OPERATOR_TYPED(EQUAL_INT, ==);
+				DISASSEMBLE_OPERATOR_TYPED(NOT_EQUAL_INT, !=);
+				DISASSEMBLE_OPERATOR_TYPED(LESS_INT, <);
+				DISASSEMBLE_OPERATOR_TYPED(LESS_EQUAL_INT, <=);
+				DISASSEMBLE_OPERATOR_TYPED(GREATER_INT, >);
+				DISASSEMBLE_OPERATOR_TYPED(GREATER_EQUAL_INT, >=);
+				DISASSEMBLE_OPERATOR_TYPED(ADD_FLOAT, +);
+				DISASSEMBLE_OPERATOR_TYPED(SUBTRACT_FLOAT, -);
+				DISASSEMBLE_OPERATOR_TYPED(MULTIPLY_FLOAT, *);
+				DISASSEMBLE_OPERATOR_TYPED(DIVIDE_FLOAT, /);
+				DISASSEMBLE_OPERATOR_TYPED(EQUAL_FLOAT, ==);
+				DISASSEMBLE_OPERATOR_TYPED(NOT_EQUAL_FLOAT, !=);
+				DISASSEMBLE_OPERATOR_TYPED(LESS_FLOAT, <);
+				DISASSEMBLE_OPERATOR_TYPED(LESS_EQUAL_FLOAT, <=);
+				DISASSEMBLE_OPERATOR_TYPED(GREATER_FLOAT, >);
+				DISASSEMBLE_OPERATOR_TYPED(GREATER_EQUAL_FLOAT, >=);
+				DISASSEMBLE_OPERATOR_TYPED(ADD_VECTOR2, +);
+				DISASSEMBLE_OPERATOR_TYPED(SUBTRACT_VECTOR2, -);
+				DISASSEMBLE_OPERATOR_TYPED(MULTIPLY_VECTOR2, *);
+				DISASSEMBLE_OPERATOR_TYPED(MULTIPLY_VECTOR2_FLOAT, *);
+				DISASSEMBLE_OPERATOR_TYPED(DIVIDE_VECTOR2_FLOAT, /);
+				DISASSEMBLE_OPERATOR_TYPED(ADD_VECTOR3, +);
+				DISASSEMBLE_OPERATOR_TYPED(SUBTRACT_VECTOR3, -);
+				DISASSEMBLE_OPERATOR_TYPED(MULTIPLY_VECTOR3, *);
+				DISASSEMBLE_OPERATOR_TYPED(MULTIPLY_VECTOR3_FLOAT, *);
+				DISASSEMBLE_OPERATOR_TYPED(DIVIDE_VECTOR3_FLOAT, /);
+
+#define DISASSEMBLE_JUMP_IF_NOT_TYPED(m_name, m_op) \
+	case OPCODE_JUMP_IF_NOT_##m_name: {             \
+		text += "typed operator ";                  \
+		text += DADDR(3);                           \
+		text += " = ";                              \
+		text += DADDR(1);                           \
+		text += " " #m_op " ";                      \
+		text += DADDR(2);                           \
+		text += " and jump-if-not";                 \
+		incr += 4;                                  \
+	} break
+
+				DISASSEMBLE_JUMP_IF_NOT_TYPED(EQUAL_INT, ==);
+				DISASSEMBLE_JUMP_IF_NOT_TYPED(NOT_EQUAL_INT, !=);
+				DISASSEMBLE_JUMP_IF_NOT_TYPED(LESS_INT, <);
+				DISASSEMBLE_JUMP_IF_NOT_TYPED(LESS_EQUAL_INT, <=);
+				DISASSEMBLE_JUMP_IF_NOT_TYPED(GREATER_INT, >);
+				DISASSEMBLE_JUMP_IF_NOT_TYPED(GREATER_EQUAL_INT, >=);
+				DISASSEMBLE_JUMP_IF_NOT_TYPED(EQUAL_FLOAT, ==);
+				DISASSEMBLE_JUMP_IF_NOT_TYPED(NOT_EQUAL_FLOAT, !=);
+				DISASSEMBLE_JUMP_IF_NOT_TYPED(LESS_FLOAT, <);
+				DISASSEMBLE_JUMP_IF_NOT_TYPED(LESS_EQUAL_FLOAT, <=);
+				DISASSEMBLE_JUMP_IF_NOT_TYPED(GREATER_FLOAT, >);
+				DISASSEMBLE_JUMP_IF_NOT_TYPED(GREATER_EQUAL_FLOAT, >=);
+
 			case OPCODE_TYPE_TEST_BUILTIN: {
 				text += "type test ";
 				text += DADDR(1);
@@ -310,7 +376,7 @@ void GDScriptFunction::disassemble(const Vector<String> &p_code_lines) const {
 				text += "\"] = ";
 				text += DADDR(2);
 
-				incr += 4;
+				incr += 5;
 			} break;
 			case OPCODE_SET_NAMED_VALIDATED: {
 				text += "set_named validated ";
@@ -331,7 +397,7 @@ void GDScriptFunction::disassemble(const Vector<String> &p_code_lines) const {
 				text += _global_names_ptr[_code_ptr[ip + 3]];
 				text += "\"]";
 
-				incr += 4;
+				incr += 5;
 			} break;
 			case OPCODE_GET_NAMED_VALIDATED: {
 				text += "get_named validated ";
@@ -710,7 +776,7 @@ void GDScriptFunction::disassemble(const Vector<String> &p_code_lines) const {
 				}
 				text += ")";
 
-				incr = 5 + argc;
+				incr = 6 + argc;
 			} break;
 			case OPCODE_CALL_METHOD_BIND:
 			case OPCODE_CALL_METHOD_BIND_RET: {
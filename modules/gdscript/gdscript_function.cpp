@@ -34,6 +34,10 @@
 
 #include "gdscript.h"
 
+#include "scene/scene_string_names.h"
+
+SafeNumeric<uint32_t> GDScriptFunction::inline_cache_epoch(1);
+
 Variant GDScriptFunction::get_constant(int p_idx) const {
 	ERR_FAIL_INDEX_V(p_idx, constants.size(), "<errconst>");
 	return constants[p_idx];
@@ -106,6 +110,141 @@ void GDScriptFunction::debug_get_stack_member_state(int p_line, List<Pair<String
 	}
 }
 
+void GDScriptFunction::_tier_up() {
+	if (tiered_up.is_set() || tier_up_claims.increment() != 1) {
+		return;
+	}
+
+	// Other threads may be running this function meanwhile, so each opcode is published with a single
+	// atomic store. Each comparison keeps its size, and the branch after it is left in place, so the
+	// comparison and its fused form are both valid at that position, whichever one a thread reads.
+	// Jumps into either instruction and suspended states stay valid as well.
+	static_assert(sizeof(std::atomic<int>) == sizeof(int) && alignof(std::atomic<int>) == alignof(int) && std::atomic<int>::is_always_lock_free);
+	for (int position : tier_up_branches) {
+		int fused_opcode;
+		switch (_code_ptr[position]) {
+			case OPCODE_OPERATOR_EQUAL_INT:
+				fused_opcode = OPCODE_JUMP_IF_NOT_EQUAL_INT;
+				break;
+			case OPCODE_OPERATOR_NOT_EQUAL_INT:
+				fused_opcode = OPCODE_JUMP_IF_NOT_NOT_EQUAL_INT;
+				break;
+			case OPCODE_OPERATOR_LESS_INT:
+				fused_opcode = OPCODE_JUMP_IF_NOT_LESS_INT;
+				break;
+			case OPCODE_OPERATOR_LESS_EQUAL_INT:
+				fused_opcode = OPCODE_JUMP_IF_NOT_LESS_EQUAL_INT;
+				break;
+			case OPCODE_OPERATOR_GREATER_INT:
+				fused_opcode = OPCODE_JUMP_IF_NOT_GREATER_INT;
+				break;
+			case OPCODE_OPERATOR_GREATER_EQUAL_INT:
+				fused_opcode = OPCODE_JUMP_IF_NOT_GREATER_EQUAL_INT;
+				break;
+			case OPCODE_OPERATOR_EQUAL_FLOAT:
+				fused_opcode = OPCODE_JUMP_IF_NOT_EQUAL_FLOAT;
+				break;
+			case OPCODE_OPERATOR_NOT_EQUAL_FLOAT:
+				fused_opcode = OPCODE_JUMP_IF_NOT_NOT_EQUAL_FLOAT;
+				break;
+			case OPCODE_OPERATOR_LESS_FLOAT:
+				fused_opcode = OPCODE_JUMP_IF_NOT_LESS_FLOAT;
+				break;
+			case OPCODE_OPERATOR_LESS_EQUAL_FLOAT:
+				fused_opcode = OPCODE_JUMP_IF_NOT_LESS_EQUAL_FLOAT;
+				break;
+			case OPCODE_OPERATOR_GREATER_FLOAT:
+				fused_opcode = OPCODE_JUMP_IF_NOT_GREATER_FLOAT;
+				break;
+			case OPCODE_OPERATOR_GREATER_EQUAL_FLOAT:
+				fused_opcode = OPCODE_JUMP_IF_NOT_GREATER_EQUAL_FLOAT;
+				break;
+			default:
+				ERR_PRINT("Compiler bug: unexpected opcode at tier-up branch.");
+				continue;
+		}
+		reinterpret_cast<std::atomic<int> *>(&_code_ptr[position])->store(fused_opcode, std::memory_order_release);
+	}
+
+	tiered_up.set();
+}
+
+bool GDScriptFunction::_inline_cache_has_free_entry(const InlineCache &p_cache) {
+	const uint32_t epoch = inline_cache_epoch.get();
+	for (const InlineCache::Entry &entry : p_cache.entries) {
+		if (entry.epoch.get() != epoch) {
+			return true;
+		}
+	}
+	return false;
+}
+
+void GDScriptFunction::_fill_inline_cache(InlineCache &p_cache, const GDScript *p_script, int p_member_index, const GDScriptDataType *p_member_type, GDScriptFunction *p_function) {
+	static Mutex inline_cache_mutex;
+	MutexLock lock(inline_cache_mutex);
+
+	// Entries of the current epoch are never rewritten. Stale ones are invalidated before being
+	// rewritten, so readers copying them meanwhile see their epoch change and don't use the copy.
+	const uint32_t epoch = inline_cache_epoch.get();
+	for (InlineCache::Entry &entry : p_cache.entries) {
+		if (entry.epoch.get() == epoch) {
+			if (entry.target.script == p_script) {
+				return;
+			}
+			continue;
+		}
+		entry.epoch.set(0); // Never current, the epoch starts at 1.
+		std::atomic_thread_fence(std::memory_order_release);
+		entry.target.script = p_script;
+		entry.target.member_index = p_member_index;
+		entry.target.member_type = p_member_type;
+		entry.target.function = p_function;
+		entry.epoch.set(epoch);
+		return;
+	}
+}
+
+void GDScriptFunction::_update_named_inline_cache(InlineCache &p_cache, const GDScriptInstance *p_instance, const StringName &p_name, bool p_set) {
+	if (!_inline_cache_has_free_entry(p_cache)) {
+		return; // Polymorphic beyond the cache size, keep using the generic path.
+	}
+
+	// Only plain members are cached, properties with accessors still go through the instance.
+	const GDScript *script = p_instance->script.ptr();
+	if (unlikely(!script->valid)) {
+		return;
+	}
+	HashMap<StringName, GDScript::MemberInfo>::ConstIterator E = script->member_indices.find(p_name);
+	if (!E || (p_set ? E->value.setter : E->value.getter) != StringName()) {
+		return;
+	}
+
+	_fill_inline_cache(p_cache, script, E->value.index, &E->value.data_type, nullptr);
+}
+
+void GDScriptFunction::_update_call_inline_cache(InlineCache &p_cache, const GDScriptInstance *p_instance, const StringName &p_method) {
+	// `_ready()` also runs the implicit ready functions and `free()` is handled by the object itself.
+	if (p_method == SceneStringName(_ready) || p_method == CoreStringName(free_)) {
+		return;
+	}
+
+	if (!_inline_cache_has_free_entry(p_cache)) {
+		return; // Polymorphic beyond the cache size, keep using the generic path.
+	}
+
+	// Same lookup as `GDScriptInstance::callp()`.
+	const GDScript *script = p_instance->script.ptr();
+	for (const GDScript *sptr = script; sptr; sptr = sptr->_base) {
+		if (likely(sptr->valid)) {
+			HashMap<StringName, GDScriptFunction *>::ConstIterator E = sptr->member_functions.find(p_method);
+			if (E) {
+				_fill_inline_cache(p_cache, script, -1, nullptr, E->value);
+				return;
+			}
+		}
+	}
+}
+
 GDScriptFunction::GDScriptFunction() {
 	name = "<anonymous>";
 #ifdef DEBUG_ENABLED
@@ -117,8 +256,13 @@ GDScriptFunction::GDScriptFunction() {
 }
 
 GDScriptFunction::~GDScriptFunction() {
+	invalidate_inline_caches();
 	get_script()->member_functions.erase(name);
 
+	if (_inline_caches_ptr) {
+		memdelete_arr(_inline_caches_ptr);
+	}
+
 	for (int i = 0; i < lambdas.size(); i++) {
 		memdelete(lambdas[i]);
 	}
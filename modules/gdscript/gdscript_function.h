@@ -39,6 +39,7 @@
 #include "core/os/thread.h"
 #include "core/string/string_name.h"
 #include "core/templates/pair.h"
+#include "core/templates/safe_refcount.h"
 #include "core/templates/self_list.h"
 #include "core/variant/variant.h"
 
@@ -258,6 +259,47 @@ public:
 	enum Opcode {
 		OPCODE_OPERATOR,
 		OPCODE_OPERATOR_VALIDATED,
+		OPCODE_OPERATOR_ADD_INT,
+		OPCODE_OPERATOR_SUBTRACT_INT,
+		OPCODE_OPERATOR_MULTIPLY_INT,
+		OPCODE_OPERATOR_EQUAL_INT,
+		OPCODE_OPERATOR_NOT_EQUAL_INT,
+		OPCODE_OPERATOR_LESS_INT,
+		OPCODE_OPERATOR_LESS_EQUAL_INT,
+		OPCODE_OPERATOR_GREATER_INT,
+		OPCODE_OPERATOR_GREATER_EQUAL_INT,
+		OPCODE_OPERATOR_ADD_FLOAT,
+		OPCODE_OPERATOR_SUBTRACT_FLOAT,
+		OPCODE_OPERATOR_MULTIPLY_FLOAT,
+		OPCODE_OPERATOR_DIVIDE_FLOAT,
+		OPCODE_OPERATOR_EQUAL_FLOAT,
+		OPCODE_OPERATOR_NOT_EQUAL_FLOAT,
+		OPCODE_OPERATOR_LESS_FLOAT,
+		OPCODE_OPERATOR_LESS_EQUAL_FLOAT,
+		OPCODE_OPERATOR_GREATER_FLOAT,
+		OPCODE_OPERATOR_GREATER_EQUAL_FLOAT,
+		OPCODE_OPERATOR_ADD_VECTOR2,
+		OPCODE_OPERATOR_SUBTRACT_VECTOR2,
+		OPCODE_OPERATOR_MULTIPLY_VECTOR2,
+		OPCODE_OPERATOR_MULTIPLY_VECTOR2_FLOAT,
+		OPCODE_OPERATOR_DIVIDE_VECTOR2_FLOAT,
+		OPCODE_OPERATOR_ADD_VECTOR3,
+		OPCODE_OPERATOR_SUBTRACT_VECTOR3,
+		OPCODE_OPERATOR_MULTIPLY_VECTOR3,
+		OPCODE_OPERATOR_MULTIPLY_VECTOR3_FLOAT,
+		OPCODE_OPERATOR_DIVIDE_VECTOR3_FLOAT,
+		OPCODE_JUMP_IF_NOT_EQUAL_INT, // Only written when tiering up.
+		OPCODE_JUMP_IF_NOT_NOT_EQUAL_INT,
+		OPCODE_JUMP_IF_NOT_LESS_INT,
+		OPCODE_JUMP_IF_NOT_LESS_EQUAL_INT,
+		OPCODE_JUMP_IF_NOT_GREATER_INT,
+		OPCODE_JUMP_IF_NOT_GREATER_EQUAL_INT,
+		OPCODE_JUMP_IF_NOT_EQUAL_FLOAT,
+		OPCODE_JUMP_IF_NOT_NOT_EQUAL_FLOAT,
+		OPCODE_JUMP_IF_NOT_LESS_FLOAT,
+		OPCODE_JUMP_IF_NOT_LESS_EQUAL_FLOAT,
+		OPCODE_JUMP_IF_NOT_GREATER_FLOAT,
+		OPCODE_JUMP_IF_NOT_GREATER_EQUAL_FLOAT,
 		OPCODE_TYPE_TEST_BUILTIN,
 		OPCODE_TYPE_TEST_ARRAY,
 		OPCODE_TYPE_TEST_DICTIONARY,
@@ -484,6 +526,37 @@ private:
 	Vector<MethodBind *> methods;
 	Vector<GDScriptFunction *> lambdas;
 
+	// Typed comparisons directly followed by a branch on their result. When the function
+	// gets hot, they are rewritten to fused compare-and-branch opcodes.
+	Vector<int> tier_up_branches;
+	SafeNumeric<uint32_t> tier_up_calls;
+	SafeNumeric<uint32_t> tier_up_claims; // Only the first thread to claim the tier-up rewrites the code.
+	SafeFlag tiered_up;
+
+	// Per-instruction caches for named gets, named sets and dynamic calls, keyed by the
+	// script of the receiving instance. Entries are only trusted while their epoch matches
+	// `inline_cache_epoch`, which is bumped whenever scripts or their functions go away.
+	struct InlineCache {
+		static constexpr int ENTRY_COUNT = 2;
+
+		struct Target {
+			const GDScript *script = nullptr;
+			int member_index = -1;
+			const GDScriptDataType *member_type = nullptr;
+			GDScriptFunction *function = nullptr;
+		};
+
+		// Read like a seqlock: the target is copied, then only used if the epoch didn't change meanwhile.
+		struct Entry {
+			SafeNumeric<uint32_t> epoch;
+			Target target;
+		};
+
+		Entry entries[ENTRY_COUNT];
+	};
+
+	static SafeNumeric<uint32_t> inline_cache_epoch;
+
 	int _code_size = 0;
 	int _default_arg_count = 0;
 	int _constant_count = 0;
@@ -501,6 +574,7 @@ private:
 	int _gds_utilities_count = 0;
 	int _methods_count = 0;
 	int _lambdas_count = 0;
+	int _inline_caches_count = 0;
 
 	int *_code_ptr = nullptr;
 	const int *_default_arg_ptr = nullptr;
@@ -519,6 +593,7 @@ private:
 	const GDScriptUtilityFunctions::FunctionPtr *_gds_utilities_ptr = nullptr;
 	MethodBind **_methods_ptr = nullptr;
 	GDScriptFunction **_lambdas_ptr = nullptr;
+	InlineCache *_inline_caches_ptr = nullptr;
 
 #ifdef DEBUG_ENABLED
 	CharString func_cname;
@@ -553,11 +628,22 @@ private:
 	} profile;
 #endif
 
+	void _tier_up();
+
+	_FORCE_INLINE_ static GDScriptInstance *_get_inline_cache_instance(const Variant *p_base);
+	_FORCE_INLINE_ static bool _find_inline_cache_entry(const InlineCache &p_cache, const GDScript *p_script, InlineCache::Target &r_target);
+	static bool _inline_cache_has_free_entry(const InlineCache &p_cache);
+	static void _fill_inline_cache(InlineCache &p_cache, const GDScript *p_script, int p_member_index, const GDScriptDataType *p_member_type, GDScriptFunction *p_function);
+	static void _update_named_inline_cache(InlineCache &p_cache, const GDScriptInstance *p_instance, const StringName &p_name, bool p_set);
+	static void _update_call_inline_cache(InlineCache &p_cache, const GDScriptInstance *p_instance, const StringName &p_method);
+
 	_FORCE_INLINE_ String _get_call_error(const String &p_where, const Variant **p_argptrs, const Variant &p_ret, const Callable::CallError &p_err) const;
 	Variant _get_default_variant_for_data_type(const GDScriptDataType &p_data_type);
 
 public:
 	static constexpr int MAX_CALL_DEPTH = 2048; // Limit to try to avoid crash because of a stack overflow.
+	static constexpr uint32_t TIER_UP_CALL_THRESHOLD = 1000;
+	static constexpr uint32_t TIER_UP_BACK_EDGE_THRESHOLD = 10000;
 
 	struct CallState {
 		GDScript *script = nullptr;
@@ -589,6 +675,9 @@ public:
 	Variant call(GDScriptInstance *p_instance, const Variant **p_args, int p_argcount, Callable::CallError &r_err, CallState *p_state = nullptr);
 	void debug_get_stack_member_state(int p_line, List<Pair<StringName, int>> *r_stackvars) const;
 
+	// Drops every inline cache entry, must be called before cached scripts or functions are changed or freed.
+	static void invalidate_inline_caches() { inline_cache_epoch.increment(); }
+
 #ifdef DEBUG_ENABLED
 	void _profile_native_call(uint64_t p_t_taken, const String &p_function_name, const String &p_instance_class_name = String());
 	void disassemble(const Vector<String> &p_code_lines) const;
@@ -34,6 +34,7 @@
 #include "gdscript_function.h"
 #include "gdscript_lambda_callable.h"
 
+#include "core/debugger/trace_profiler.h"
 #include "core/os/os.h"
 
 #ifdef DEBUG_ENABLED
@@ -152,6 +153,40 @@ Variant GDScriptFunction::_get_default_variant_for_data_type(const GDScriptDataT
 	return Variant();
 }
 
+GDScriptInstance *GDScriptFunction::_get_inline_cache_instance(const Variant *p_base) {
+	if (p_base->get_type() != Variant::OBJECT) {
+		return nullptr;
+	}
+	Object *obj = p_base->get_validated_object();
+	if (!obj) {
+		return nullptr;
+	}
+	ScriptInstance *script_instance = obj->get_script_instance();
+	if (!script_instance || script_instance->get_language() != GDScriptLanguage::get_singleton() || script_instance->is_placeholder()) {
+		return nullptr;
+	}
+	return static_cast<GDScriptInstance *>(script_instance);
+}
+
+bool GDScriptFunction::_find_inline_cache_entry(const InlineCache &p_cache, const GDScript *p_script, InlineCache::Target &r_target) {
+	const uint32_t epoch = inline_cache_epoch.get();
+	for (const InlineCache::Entry &entry : p_cache.entries) {
+		if (entry.epoch.get() != epoch) {
+			continue;
+		}
+		r_target = entry.target;
+		// The entry may have been rewritten for another script while copying it, it's then left to the generic path.
+		std::atomic_thread_fence(std::memory_order_acquire);
+		if (entry.epoch.get() != epoch) {
+			return false;
+		}
+		if (r_target.script == p_script) {
+			return true;
+		}
+	}
+	return false;
+}
+
 String GDScriptFunction::_get_call_error(const String &p_where, const Variant **p_argptrs, const Variant &p_ret, const Callable::CallError &p_err) const {
 	switch (p_err.error) {
 		case Callable::CallError::CALL_OK:
@@ -229,11 +264,56 @@ void (*type_init_function_table[])(Variant *) = {
 	&VariantInitializer<PackedVector4Array>::init, // PACKED_VECTOR4_ARRAY.
 };
 
+// Opcodes are read atomically, since tier-up may rewrite them while other threads run the function.
+// Relaxed loads compile to plain loads, the rewritten opcode and its operands are valid either way.
+#define READ_OPCODE(m_ip) (reinterpret_cast<const std::atomic<int> *>(&_code_ptr[m_ip])->load(std::memory_order_relaxed))
+
 #if defined(__GNUC__) || defined(__clang__)
 #define OPCODES_TABLE                                    \
 	static const void *switch_table_ops[] = {            \
 		&&OPCODE_OPERATOR,                               \
 		&&OPCODE_OPERATOR_VALIDATED,                     \
+		&&OPCODE_OPERATOR_ADD_INT,                       \
+		&&OPCODE_OPERATOR_SUBTRACT_INT,                  \
+		&&OPCODE_OPERATOR_MULTIPLY_INT,                  \
+		&&OPCODE_OPERATOR_EQUAL_INT,                     \
+		&&OPCODE_OPERATOR_NOT_EQUAL_INT,                 \
+		&&OPCODE_OPERATOR_LESS_INT,                      \
+		&&OPCODE_OPERATOR_LESS_EQUAL_INT,                \
+		&&OPCODE_OPERATOR_GREATER_INT,                   \
+		&&OPCODE_OPERATOR_GREATER_EQUAL_INT,             \
+		&&OPCODE_OPERATOR_ADD_FLOAT,                     \
+		&&OPCODE_OPERATOR_SUBTRACT_FLOAT,                \
+		&&OPCODE_OPERATOR_MULTIPLY_FLOAT,                \
+		&&OPCODE_OPERATOR_DIVIDE_FLOAT,                  \
+		&&OPCODE_OPERATOR_EQUAL_FLOAT,                   \
+		&&OPCODE_OPERATOR_NOT_EQUAL_FLOAT,               \
+		&&OPCODE_OPERATOR_LESS_FLOAT,                    \
+		&&OPCODE_OPERATOR_LESS_EQUAL_FLOAT,              \
+		&&OPCODE_OPERATOR_GREATER_FLOAT,                 \
+		&&OPCODE_OPERATOR_GREATER_EQUAL_FLOAT,           \
+		&&OPCODE_OPERATOR_ADD_VECTOR2,                   \
+		&&OPCODE_OPERATOR_SUBTRACT_VECTOR2,              \
+		&&OPCODE_OPERATOR_MULTIPLY_VECTOR2,              \
+		&&OPCODE_OPERATOR_MULTIPLY_VECTOR2_FLOAT,        \
+		&&OPCODE_OPERATOR_DIVIDE_VECTOR2_FLOAT,          \
+		&&OPCODE_OPERATOR_ADD_VECTOR3,                   \
+		&&OPCODE_OPERATOR_SUBTRACT_VECTOR3,              \
+		&&OPCODE_OPERATOR_MULTIPLY_VECTOR3,              \
+		&&OPCODE_OPERATOR_MULTIPLY_VECTOR3_FLOAT,        \
+		&&OPCODE_OPERATOR_DIVIDE_VECTOR3_FLOAT,          \
+		&&OPCODE_JUMP_IF_NOT_EQUAL_INT,                  \
+		&&OPCODE_JUMP_IF_NOT_NOT_EQUAL_INT,              \
+		&&OPCODE_JUMP_IF_NOT_LESS_INT,                   \
+		&&OPCODE_JUMP_IF_NOT_LESS_EQUAL_INT,             \
+		&&OPCODE_JUMP_IF_NOT_GREATER_INT,                \
+		&&OPCODE_JUMP_IF_NOT_GREATER_EQUAL_INT,          \
+		&&OPCODE_JUMP_IF_NOT_EQUAL_FLOAT,                \
+		&&OPCODE_JUMP_IF_NOT_NOT_EQUAL_FLOAT,            \
+		&&OPCODE_JUMP_IF_NOT_LESS_FLOAT,                 \
+		&&OPCODE_JUMP_IF_NOT_LESS_EQUAL_FLOAT,           \
+		&&OPCODE_JUMP_IF_NOT_GREATER_FLOAT,              \
+		&&OPCODE_JUMP_IF_NOT_GREATER_EQUAL_FLOAT,        \
 		&&OPCODE_TYPE_TEST_BUILTIN,                      \
 		&&OPCODE_TYPE_TEST_ARRAY,                        \
 		&&OPCODE_TYPE_TEST_DICTIONARY,                   \
@@ -401,11 +481,11 @@ void (*type_init_function_table[])(Variant *) = {
 #define OPCODE_SWITCH(m_test) goto *switch_table_ops[m_test];
 
 #ifdef DEBUG_ENABLED
-#define DISPATCH_OPCODE          \
-	last_opcode = _code_ptr[ip]; \
+#define DISPATCH_OPCODE            \
+	last_opcode = READ_OPCODE(ip); \
 	goto *switch_table_ops[last_opcode]
 #else // !DEBUG_ENABLED
-#define DISPATCH_OPCODE goto *switch_table_ops[_code_ptr[ip]]
+#define DISPATCH_OPCODE goto *switch_table_ops[READ_OPCODE(ip)]
 #endif // DEBUG_ENABLED
 
 #define OPCODE_BREAK goto OPSEXIT
@@ -475,6 +555,8 @@ void (*type_init_function_table[])(Variant *) = {
 Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_args, int p_argcount, Callable::CallError &r_err, CallState *p_state) {
 	OPCODES_TABLE;
 
+	TRACE_ZONE_DETAIL("GDScriptFunction::call", name);
+
 	if (!_code_ptr) {
 		return _get_default_variant_for_data_type(return_type);
 	}
@@ -700,17 +782,22 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 	int variant_address_limits[ADDR_TYPE_MAX] = { _stack_size, _constant_count, p_instance ? (int)p_instance->members.size() : 0 };
 #endif
 
+	if (unlikely(!tier_up_branches.is_empty() && !tiered_up.is_set()) && tier_up_calls.increment() == TIER_UP_CALL_THRESHOLD) {
+		_tier_up();
+	}
+	uint32_t back_edges = 0;
+
 	bool awaited = false;
 	Variant *variant_addresses[ADDR_TYPE_MAX] = { stack, _constants_ptr, p_instance ? p_instance->members.ptrw() : nullptr };
 
 #ifdef DEBUG_ENABLED
 	OPCODE_WHILE(ip < _code_size) {
-		int last_opcode = _code_ptr[ip];
+		int last_opcode = READ_OPCODE(ip);
 #else
 	OPCODE_WHILE(true) {
 #endif
 
-		OPCODE_SWITCH(_code_ptr[ip]) {
+		OPCODE_SWITCH(READ_OPCODE(ip)) {
 			OPCODE(OPCODE_OPERATOR) {
 				constexpr int _pointer_size = sizeof(Variant::ValidatedOperatorEvaluator) / sizeof(*_code_ptr);
 				CHECK_SPACE(7 + _pointer_size);
@@ -815,6 +902,81 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 			}
 			DISPATCH_OPCODE;
 
+#define OPCODE_OPERATOR_TYPED(m_name, m_ret_type, m_left_type, m_right_type, m_op)    \
+	OPCODE(OPCODE_OPERATOR_##m_name) {                                                \
+		CHECK_SPACE(4);                                                               \
+		GET_VARIANT_PTR(a, 0);                                                        \
+		GET_VARIANT_PTR(b, 1);                                                        \
+		GET_VARIANT_PTR(dst, 2);                                                      \
+		const m_left_type &left = *VariantGetInternalPtr<m_left_type>::get_ptr(a);    \
+		const m_right_type &right = *VariantGetInternalPtr<m_right_type>::get_ptr(b); \
+		*VariantGetInternalPtr<m_ret_type>::get_ptr(dst) = left m_op right;           \
+		ip += 4;                                                                      \
+	}                                                                                 \
+	DISPATCH_OPCODE
+
+			OPCODE_OPERATOR_TYPED(ADD_INT, int64_t, int64_t, int64_t, +);
+			OPCODE_OPERATOR_TYPED(SUBTRACT_INT, int64_t, int64_t, int64_t, -);
+			OPCODE_OPERATOR_TYPED(MULTIPLY_INT, int64_t, int64_t, int64_t, *);
+			OPCODE_OPERATOR_TYPED(EQUAL_INT, bool, int64_t, int64_t, ==);
+			OPCODE_OPERATOR_TYPED(NOT_EQUAL_INT, bool, int64_t, int64_t, !=);
+			OPCODE_OPERATOR_TYPED(LESS_INT, bool, int64_t, int64_t, <);
+			OPCODE_OPERATOR_TYPED(LESS_EQUAL_INT, bool, int64_t, int64_t, <=);
+			OPCODE_OPERATOR_TYPED(GREATER_INT, bool, int64_t, int64_t, >);
+			OPCODE_OPERATOR_TYPED(GREATER_EQUAL_INT, bool, int64_t, int64_t, >=);
+			OPCODE_OPERATOR_TYPED(ADD_FLOAT, double, double, double, +);
+			OPCODE_OPERATOR_TYPED(SUBTRACT_FLOAT, double, double, double, -);
+			OPCODE_OPERATOR_TYPED(MULTIPLY_FLOAT, double, double, double, *);
+			OPCODE_OPERATOR_TYPED(DIVIDE_FLOAT, double, double, double, /);
+			OPCODE_OPERATOR_TYPED(EQUAL_FLOAT, bool, double, double, ==);
+			OPCODE_OPERATOR_TYPED(NOT_EQUAL_FLOAT, bool, double, double, !=);
+			OPCODE_OPERATOR_TYPED(LESS_FLOAT, bool, double, double, <);
+			OPCODE_OPERATOR_TYPED(LESS_EQUAL_FLOAT, bool, double, double, <=);
+			OPCODE_OPERATOR_TYPED(GREATER_FLOAT, bool, double, double, >);
+			OPCODE_OPERATOR_TYPED(GREATER_EQUAL_FLOAT, bool, double, double, >=);
+			OPCODE_OPERATOR_TYPED(ADD_VECTOR2, Vector2, Vector2, Vector2, +);
+			OPCODE_OPERATOR_TYPED(SUBTRACT_VECTOR2, Vector2, Vector2, Vector2, -);
+			OPCODE_OPERATOR_TYPED(MULTIPLY_VECTOR2, Vector2, Vector2, Vector2, *);
+			OPCODE_OPERATOR_TYPED(MULTIPLY_VECTOR2_FLOAT, Vector2, Vector2, double, *);
+			OPCODE_OPERATOR_TYPED(DIVIDE_VECTOR2_FLOAT, Vector2, Vector2, double, /);
+			OPCODE_OPERATOR_TYPED(ADD_VECTOR3, Vector3, Vector3, Vector3, +);
+			OPCODE_OPERATOR_TYPED(SUBTRACT_VECTOR3, Vector3, Vector3, Vector3, -);
+			OPCODE_OPERATOR_TYPED(MULTIPLY_VECTOR3, Vector3, Vector3, Vector3, *);
+			OPCODE_OPERATOR_TYPED(MULTIPLY_VECTOR3_FLOAT, Vector3, Vector3, double, *);
+			OPCODE_OPERATOR_TYPED(DIVIDE_VECTOR3_FLOAT, Vector3, Vector3, double, /);
+
+// The original OPCODE_JUMP_IF_NOT is kept right after these, so they can take its target.
+#define OPCODE_JUMP_IF_NOT_TYPED(m_name, m_type, m_op)                                                            \
+	OPCODE(OPCODE_JUMP_IF_NOT_##m_name) {                                                                         \
+		CHECK_SPACE(7);                                                                                           \
+		GET_VARIANT_PTR(a, 0);                                                                                    \
+		GET_VARIANT_PTR(b, 1);                                                                                    \
+		GET_VARIANT_PTR(dst, 2);                                                                                  \
+		bool result = *VariantGetInternalPtr<m_type>::get_ptr(a) m_op *VariantGetInternalPtr<m_type>::get_ptr(b); \
+		*VariantInternal::get_bool(dst) = result;                                                                 \
+		if (!result) {                                                                                            \
+			int to = _code_ptr[ip + 6];                                                                           \
+			GD_ERR_BREAK(to < 0 || to > _code_size);                                                              \
+			ip = to;                                                                                              \
+		} else {                                                                                                  \
+			ip += 7; /* Skip the original branch as well. */                                                      \
+		}                                                                                                         \
+	}                                                                                                             \
+	DISPATCH_OPCODE
+
+			OPCODE_JUMP_IF_NOT_TYPED(EQUAL_INT, int64_t, ==);
+			OPCODE_JUMP_IF_NOT_TYPED(NOT_EQUAL_INT, int64_t, !=);
+			OPCODE_JUMP_IF_NOT_TYPED(LESS_INT, int64_t, <);
+			OPCODE_JUMP_IF_NOT_TYPED(LESS_EQUAL_INT, int64_t, <=);
+			OPCODE_JUMP_IF_NOT_TYPED(GREATER_INT, int64_t, >);
+			OPCODE_JUMP_IF_NOT_TYPED(GREATER_EQUAL_INT, int64_t, >=);
+			OPCODE_JUMP_IF_NOT_TYPED(EQUAL_FLOAT, double, ==);
+			OPCODE_JUMP_IF_NOT_TYPED(NOT_EQUAL_FLOAT, double, !=);
+			OPCODE_JUMP_IF_NOT_TYPED(LESS_FLOAT, double, <);
+			OPCODE_JUMP_IF_NOT_TYPED(LESS_EQUAL_FLOAT, double, <=);
+			OPCODE_JUMP_IF_NOT_TYPED(GREATER_FLOAT, double, >);
+			OPCODE_JUMP_IF_NOT_TYPED(GREATER_EQUAL_FLOAT, double, >=);
+
 			OPCODE(OPCODE_TYPE_TEST_BUILTIN) {
 				CHECK_SPACE(4);
 
@@ -1159,7 +1321,7 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 			DISPATCH_OPCODE;
 
 			OPCODE(OPCODE_SET_NAMED) {
-				CHECK_SPACE(3);
+				CHECK_SPACE(5);
 
 				GET_VARIANT_PTR(dst, 0);
 				GET_VARIANT_PTR(value, 1);
@@ -1169,6 +1331,24 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 				GD_ERR_BREAK(indexname < 0 || indexname >= _global_names_count);
 				const StringName *index = &_global_names_ptr[indexname];
 
+				int cache_index = _code_ptr[ip + 4];
+				GD_ERR_BREAK(cache_index < 0 || cache_index >= _inline_caches_count);
+				InlineCache &cache = _inline_caches_ptr[cache_index];
+
+				GDScriptInstance *dst_instance = _get_inline_cache_instance(dst);
+				if (dst_instance) {
+					InlineCache::Target target;
+					if (_find_inline_cache_entry(cache, dst_instance->script.ptr(), target) && target.member_index < dst_instance->members.size() && target.member_type->is_type(*value)) {
+#ifdef TOOLS_ENABLED
+						dst_instance->owner->set_edited(true);
+#endif
+						dst_instance->members.write[target.member_index] = *value;
+						ip += 5;
+						DISPATCH_OPCODE;
+					}
+					_update_named_inline_cache(cache, dst_instance, *index, true);
+				}
+
 				bool valid;
 				dst->set_named(*index, *value, valid);
 
@@ -1191,7 +1371,7 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 					OPCODE_BREAK;
 				}
 #endif
-				ip += 4;
+				ip += 5;
 			}
 			DISPATCH_OPCODE;
 
@@ -1211,7 +1391,7 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 			DISPATCH_OPCODE;
 
 			OPCODE(OPCODE_GET_NAMED) {
-				CHECK_SPACE(4);
+				CHECK_SPACE(5);
 
 				GET_VARIANT_PTR(src, 0);
 				GET_VARIANT_PTR(dst, 1);
@@ -1221,6 +1401,26 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 				GD_ERR_BREAK(indexname < 0 || indexname >= _global_names_count);
 				const StringName *index = &_global_names_ptr[indexname];
 
+				int cache_index = _code_ptr[ip + 4];
+				GD_ERR_BREAK(cache_index < 0 || cache_index >= _inline_caches_count);
+				InlineCache &cache = _inline_caches_ptr[cache_index];
+
+				GDScriptInstance *src_instance = _get_inline_cache_instance(src);
+				if (src_instance) {
+					InlineCache::Target target;
+					if (_find_inline_cache_entry(cache, src_instance->script.ptr(), target) && target.member_index < src_instance->members.size()) {
+						const Variant &member = src_instance->members[target.member_index];
+						if (likely(dst != src)) {
+							*dst = member;
+						} else {
+							*dst = Variant(member); // Keep the instance alive while overwriting its last reference.
+						}
+						ip += 5;
+						DISPATCH_OPCODE;
+					}
+					_update_named_inline_cache(cache, src_instance, *index, false);
+				}
+
 				bool valid;
 #ifdef DEBUG_ENABLED
 				//allow better error message in cases where src and dst are the same stack position
@@ -1236,7 +1436,7 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 				}
 				*dst = ret;
 #endif
-				ip += 4;
+				ip += 5;
 			}
 			DISPATCH_OPCODE;
 
@@ -1855,7 +2055,7 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 				bool call_async = (_code_ptr[ip]) == OPCODE_CALL_ASYNC;
 #endif
 				LOAD_INSTRUCTION_ARGS
-				CHECK_SPACE(3 + instr_arg_count);
+				CHECK_SPACE(4 + instr_arg_count);
 
 				ip += instr_arg_count;
 
@@ -1866,9 +2066,25 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 				GD_ERR_BREAK(methodname_idx < 0 || methodname_idx >= _global_names_count);
 				const StringName *methodname = &_global_names_ptr[methodname_idx];
 
+				int cache_index = _code_ptr[ip + 3];
+				GD_ERR_BREAK(cache_index < 0 || cache_index >= _inline_caches_count);
+
 				GET_INSTRUCTION_ARG(base, argc);
 				Variant **argptrs = instruction_args;
 
+				// Script methods found in the inline cache are called directly, skipping the object and instance lookups.
+				GDScriptInstance *base_instance = _get_inline_cache_instance(base);
+				GDScriptFunction *cached_function = nullptr;
+				if (base_instance) {
+					InlineCache &cache = _inline_caches_ptr[cache_index];
+					InlineCache::Target target;
+					if (_find_inline_cache_entry(cache, base_instance->script.ptr(), target)) {
+						cached_function = target.function;
+					} else {
+						_update_call_inline_cache(cache, base_instance, *methodname);
+					}
+				}
+
 #ifdef DEBUG_ENABLED
 				uint64_t call_time = 0;
 
@@ -1882,9 +2098,18 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 
 				Variant temp_ret;
 				Callable::CallError err;
+				if (cached_function) {
+#ifdef DEBUG_ENABLED
+					// Same as `Object::callp()`, so the method can't free the object it runs on.
+					_ObjectDebugLock debug_lock(base_instance->owner);
+#endif
+					temp_ret = cached_function->call(base_instance, (const Variant **)argptrs, argc, err);
+				} else {
+					base->callp(*methodname, (const Variant **)argptrs, argc, temp_ret, err);
+				}
+
 				if (call_ret) {
 					GET_INSTRUCTION_ARG(ret, argc + 1);
-					base->callp(*methodname, (const Variant **)argptrs, argc, temp_ret, err);
 					*ret = temp_ret;
 #ifdef DEBUG_ENABLED
 					if (ret->get_type() == Variant::NIL) {
@@ -1913,8 +2138,6 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 						}
 					}
 #endif
-				} else {
-					base->callp(*methodname, (const Variant **)argptrs, argc, temp_ret, err);
 				}
 #ifdef DEBUG_ENABLED
 
@@ -1964,7 +2187,7 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 				}
 #endif // DEBUG_ENABLED
 
-				ip += 3;
+				ip += 4;
 			}
 			DISPATCH_OPCODE;
 
@@ -2659,6 +2882,9 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 				int to = _code_ptr[ip + 1];
 
 				GD_ERR_BREAK(to < 0 || to > _code_size);
+				if (to < ip && unlikely(++back_edges == TIER_UP_BACK_EDGE_THRESHOLD) && !tier_up_branches.is_empty()) {
+					_tier_up();
+				}
 				ip = to;
 			}
 			DISPATCH_OPCODE;
@@ -0,0 +1,56 @@
+# Untyped property accesses and method calls on script instances are served from
+# per-instruction caches, which must not change the results.
+
+class Base:
+	var value = 1
+	var typed: int = 0
+	var counted = 0:
+		set(new_value):
+			counted = new_value * 2
+
+	func describe():
+		return "Base %d" % value
+
+	func bump(amount):
+		value += amount
+
+class Derived extends Base:
+	func describe():
+		return "Derived %d" % value
+
+class Other:
+	var value = 100
+
+	func describe():
+		return "Other %d" % value
+
+	func bump(amount):
+		value -= amount
+
+func test():
+	var objects = [Base.new(), Derived.new(), Other.new()]
+	for i in 10:
+		for obj in objects:
+			obj.bump(i)
+	for obj in objects:
+		print(obj.describe())
+
+	var total = 0
+	for i in 10:
+		for obj in objects:
+			obj.value = obj.value + 1
+			total += obj.value
+	print(total)
+
+	var base = objects[0]
+	for i in 3:
+		base.counted = i + 1
+		print(base.counted)
+
+	for i in 2:
+		base.typed = 2.5 + i
+		print(base.typed)
+
+	var mixed = [objects[2], { value = 7 }, objects[2]]
+	for item in mixed:
+		print(item.value)
@@ -0,0 +1,30 @@
+# Typed int, float, Vector2 and Vector3 operands use dedicated operator opcodes.
+
+func test():
+	var a := 7
+	var b := -3
+	print(a + b, " ", a - b, " ", a * b)
+	print(a == b, " ", a != b, " ", a < b, " ", a <= 7, " ", a > b, " ", b >= 0)
+
+	var x := 1.5
+	var y := 0.25
+	print(x + y, " ", x - y, " ", x * y, " ", x / y)
+	print(x == y, " ", x != y, " ", x < y, " ", x <= 1.5, " ", x > y, " ", y >= 1.0)
+
+	var v2 := Vector2(1.0, 2.0)
+	var w2 := Vector2(0.5, 4.0)
+	print(v2 + w2, " ", v2 - w2, " ", v2 * w2, " ", v2 * x, " ", v2 / y)
+
+	var v3 := Vector3(1.0, 2.0, 3.0)
+	var w3 := Vector3(2.0, 0.5, -1.0)
+	print(v3 + w3, " ", v3 - w3, " ", v3 * w3, " ", v3 * x, " ", v3 / y)
+
+	var total := 0
+	var position := Vector2.ZERO
+	for i in 10:
+		total += i * i
+		position += Vector2(i, 1.0) * 0.5
+	print(total, " ", position)
+
+	# Mixed operands keep using the generic paths.
+	print(a * x, " ", v2 * a)
@@ -0,0 +1,34 @@
+# Hot functions have their typed comparisons fused with the branch that follows,
+# which must not change the results.
+
+func count_below(limit: int, values: Array[int]) -> int:
+	var count := 0
+	for value in values:
+		if value < limit:
+			count += 1
+	return count
+
+func classify(x: float) -> String:
+	if x == 0.0:
+		return "zero"
+	elif x > 0.0 and x <= 1.0:
+		return "unit"
+	return "other"
+
+func test():
+	var values: Array[int] = [5, -2, 9, 3, 7, 0]
+	var results := {}
+	for i in 2000:
+		var key := "%d %s" % [count_below(i % 10, values), classify((i % 5) * 0.5)]
+		results[key] = results.get(key, 0) + 1
+	var keys := results.keys()
+	keys.sort()
+	for key in keys:
+		print(key, ": ", results[key])
+
+	var n := 0
+	var total := 0
+	while n < 20000:
+		total += 1 if n % 3 != 0 else 0
+		n += 1
+	print(total)
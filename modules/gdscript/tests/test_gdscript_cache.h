@@ -0,0 +1,197 @@
+/**************************************************************************/
+/*  test_gdscript_cache.h                                                 */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             REDOT ENGINE                               */
+/*                        https://redotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2024-present Redot Engine contributors                   */
+/*                                          (see REDOT_AUTHORS.md)        */
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+
+#include "../gdscript.h"
+#include "../gdscript_cache.h"
+#include "../gdscript_tokenizer_buffer.h"
+
+#include "core/config/project_settings.h"
+#include "core/io/dir_access.h"
+#include "core/io/file_access.h"
+
+#include "tests/test_macros.h"
+#include "tests/test_utils.h"
+
+namespace TestGDScriptCache {
+
+static String _write_script_file(const String &p_name, const String &p_source) {
+	const String path = TestUtils::get_temp_path(p_name);
+	Ref<FileAccess> f = FileAccess::open(path, FileAccess::WRITE);
+	CHECK(f.is_valid());
+	f->store_string(p_source);
+	return path;
+}
+
+static Ref<GDScript> _create_script(const String &p_path, const String &p_source) {
+	Ref<GDScript> script;
+	script.instantiate();
+	script->set_path(p_path);
+	script->set_source_code(p_source);
+	return script;
+}
+
+static void _remove_script(const String &p_path) {
+	GDScriptCache::remove_script(p_path);
+	DirAccess::remove_absolute(p_path);
+}
+
+TEST_CASE("[Modules][GDScript][GDScriptCache] Reload reuses the cached parser when the source matches") {
+	GDScriptLanguage::get_singleton()->init();
+	const String source = "extends RefCounted\n\nfunc get_value():\n\treturn 42\n";
+	const String path = _write_script_file("gdscript_cache_matching.gd", source);
+
+	Error err = OK;
+	Ref<GDScriptParserRef> parser_ref = GDScriptCache::get_parser(path, GDScriptParserRef::PARSED, err);
+	REQUIRE(err == OK);
+	REQUIRE(parser_ref.is_valid());
+
+	Ref<GDScript> script = _create_script(path, source);
+	CHECK(script->reload() == OK);
+	CHECK(script->is_valid());
+
+	// Compiled from the cached parser, which was analyzed for it.
+	CHECK(GDScriptCache::has_parser(path));
+	CHECK(parser_ref->get_status() == GDScriptParserRef::FULLY_SOLVED);
+
+	Ref<RefCounted> ref_counted = memnew(RefCounted);
+	ref_counted->set_script(script);
+	CHECK(int(ref_counted->call("get_value")) == 42);
+	ref_counted->set_script(Variant());
+
+	_remove_script(path);
+}
+
+TEST_CASE("[Modules][GDScript][GDScriptCache] Reload parses again when the cached parser is stale") {
+	GDScriptLanguage::get_singleton()->init();
+	const String path = _write_script_file("gdscript_cache_stale.gd", "extends RefCounted\n\nfunc get_value():\n\treturn 1\n");
+
+	Error err = OK;
+	Ref<GDScriptParserRef> parser_ref = GDScriptCache::get_parser(path, GDScriptParserRef::PARSED, err);
+	REQUIRE(err == OK);
+
+	// Edited since the cache parsed it.
+	Ref<GDScript> script = _create_script(path, "extends RefCounted\n\nfunc get_other_value():\n\treturn 2\n");
+	CHECK(script->reload() == OK);
+	CHECK(script->is_valid());
+
+	CHECK_FALSE(GDScriptCache::has_parser(path));
+	CHECK(parser_ref->get_status() == GDScriptParserRef::PARSED);
+	CHECK(script->has_method("get_other_value"));
+	CHECK_FALSE(script->has_method("get_value"));
+
+	_remove_script(path);
+}
+
+TEST_CASE("[Modules][GDScript][GDScriptCache] Reload reports errors when the cached parser failed") {
+	GDScriptLanguage::get_singleton()->init();
+	// Parses, but fails the analysis.
+	const String source = "extends RefCounted\n\nfunc get_value():\n\treturn undefined_identifier\n";
+	const String path = _write_script_file("gdscript_cache_error.gd", source);
+
+	Error err = OK;
+	Ref<GDScriptParserRef> parser_ref = GDScriptCache::get_parser(path, GDScriptParserRef::PARSED, err);
+	REQUIRE(err == OK);
+
+	Ref<GDScript> script = _create_script(path, source);
+	ERR_PRINT_OFF;
+	CHECK(script->reload() == ERR_PARSE_ERROR);
+	ERR_PRINT_ON;
+	CHECK_FALSE(script->is_valid());
+
+	_remove_script(path);
+}
+
+TEST_CASE("[Modules][GDScript][GDScriptCache] Cached parser takes the binary tokens of the loaded script") {
+	GDScriptLanguage::get_singleton()->init();
+	const String source = "extends RefCounted\n\nfunc get_value():\n\treturn 7\n";
+	// The file on disk is not valid, so only the tokens of the script can parse.
+	const String path = _write_script_file("gdscript_cache_tokens.gdc", "not binary tokens");
+
+	Ref<GDScript> script;
+	script.instantiate();
+	script->set_path(path);
+	script->set_binary_tokens_source(GDScriptTokenizerBuffer::parse_code_string(source, GDScriptTokenizerBuffer::COMPRESS_NONE));
+	CHECK(script->reload() == OK);
+	REQUIRE(GDScriptCache::get_cached_script(path) == script);
+
+	Error err = OK;
+	Ref<GDScriptParserRef> parser_ref = GDScriptCache::get_parser(path, GDScriptParserRef::PARSED, err);
+	CHECK(err == OK);
+	REQUIRE(parser_ref.is_valid());
+	CHECK(parser_ref->get_source_hash() == hash_djb2_buffer(script->get_binary_tokens_source().ptr(), script->get_binary_tokens_source().size()));
+
+	// And reloading compiles from that parser.
+	CHECK(script->reload() == OK);
+	CHECK(parser_ref->get_status() == GDScriptParserRef::FULLY_SOLVED);
+	CHECK(script->has_method("get_value"));
+
+	_remove_script(path);
+}
+
+TEST_CASE("[Modules][GDScript][GDScriptCache] Parse global classes in parallel") {
+	const String source = "extends RefCounted\n\nfunc get_value():\n\treturn 3\n";
+	const String compiled_path = _write_script_file("gdscript_cache_parallel_compiled.gd", "class_name ParallelCompiled\n" + source);
+	const String removed_path = _write_script_file("gdscript_cache_parallel_removed.gd", "class_name ParallelRemoved\n" + source);
+	ScriptServer::add_global_class("ParallelCompiled", "RefCounted", "GDScript", compiled_path, false, false);
+	ScriptServer::add_global_class("ParallelRemoved", "RefCounted", "GDScript", removed_path, false, false);
+
+	ProjectSettings::get_singleton()->set_setting("application/run/parse_scripts_in_parallel", true);
+	GDScriptLanguage::get_singleton()->init();
+	ProjectSettings::get_singleton()->set_setting("application/run/parse_scripts_in_parallel", false);
+
+	REQUIRE(GDScriptCache::has_prepared_parser(compiled_path));
+	REQUIRE(GDScriptCache::has_prepared_parser(removed_path));
+
+	// The script is compiled from the prepared parser, which is released then.
+	Error err = OK;
+	Ref<GDScriptParserRef> parser_ref = GDScriptCache::get_parser(compiled_path, GDScriptParserRef::EMPTY, err);
+	REQUIRE(parser_ref.is_valid());
+	CHECK(parser_ref->get_status() == GDScriptParserRef::PARSED);
+	Ref<GDScript> script = GDScriptCache::get_full_script(compiled_path, err);
+	CHECK(err == OK);
+	REQUIRE(script.is_valid());
+	CHECK(script->has_method("get_value"));
+	CHECK(parser_ref->get_status() == GDScriptParserRef::FULLY_SOLVED);
+	CHECK_FALSE(GDScriptCache::has_prepared_parser(compiled_path));
+
+	GDScriptCache::remove_parser(removed_path);
+	CHECK_FALSE(GDScriptCache::has_prepared_parser(removed_path));
+
+	ScriptServer::remove_global_class("ParallelCompiled");
+	ScriptServer::remove_global_class("ParallelRemoved");
+	_remove_script(compiled_path);
+	_remove_script(removed_path);
+}
+
+} // namespace TestGDScriptCache
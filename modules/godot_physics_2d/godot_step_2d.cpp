@@ -41,6 +41,10 @@
 #define ISLAND_COUNT_RESERVE 128
 #define ISLAND_SIZE_RESERVE 512
 #define CONSTRAINT_COUNT_RESERVE 1024
+#define ISLAND_BATCH_MIN_CONSTRAINTS 64
+#define LARGE_ISLAND_MIN_CONSTRAINTS 512
+#define COLOR_PARALLEL_MIN_CONSTRAINTS 64
+#define MAX_COLORS 64
 
 void GodotStep2D::_populate_island(GodotBody2D *p_body, LocalVector<GodotBody2D *> &p_body_island, LocalVector<GodotConstraint2D *> &p_constraint_island) {
 	p_body->set_island_step(_step);
@@ -104,6 +108,133 @@ void GodotStep2D::_solve_island(uint32_t p_island_index, void *p_userdata) const
 	}
 }
 
+void GodotStep2D::_batch_islands(uint32_t p_island_count) {
+	small_islands.clear();
+	island_batches.clear();
+	large_islands.clear();
+
+	uint32_t small_constraint_count = 0;
+	for (uint32_t island_index = 0; island_index < p_island_count; ++island_index) {
+		uint32_t constraint_count = constraint_islands[island_index].size();
+		if (constraint_count >= LARGE_ISLAND_MIN_CONSTRAINTS) {
+			large_islands.push_back(island_index);
+		} else if (constraint_count > 0) {
+			small_islands.push_back(island_index);
+			small_constraint_count += constraint_count;
+		}
+	}
+
+	// Aim for a few batches per thread so the load balances, but keep them big enough for the task overhead not to dominate.
+	uint32_t batch_target = small_constraint_count / (WorkerThreadPool::get_singleton()->get_thread_count() * 4 + 1);
+	batch_target = MAX(batch_target, (uint32_t)ISLAND_BATCH_MIN_CONSTRAINTS);
+
+	uint32_t batch_constraint_count = 0;
+	for (uint32_t i = 0; i < small_islands.size(); ++i) {
+		batch_constraint_count += constraint_islands[small_islands[i]].size();
+		if (batch_constraint_count >= batch_target) {
+			island_batches.push_back(i + 1);
+			batch_constraint_count = 0;
+		}
+	}
+	if (batch_constraint_count > 0) {
+		island_batches.push_back(small_islands.size());
+	}
+}
+
+void GodotStep2D::_solve_island_batch(uint32_t p_batch_index, void *p_userdata) const {
+	uint32_t begin = p_batch_index > 0 ? island_batches[p_batch_index - 1] : 0;
+	uint32_t end = island_batches[p_batch_index];
+	for (uint32_t i = begin; i < end; ++i) {
+		_solve_island(small_islands[i]);
+	}
+}
+
+void GodotStep2D::_color_constraints(const LocalVector<GodotConstraint2D *> &p_constraint_island) {
+	// Greedy coloring: each constraint gets the first color none of its bodies uses yet, so constraints of the same color
+	// can be solved in parallel. Static and kinematic bodies are ignored, since constraints never change their velocities.
+	// Constraints that can't be colored end up in an extra bucket, solved serially.
+	uint32_t constraint_count = p_constraint_island.size();
+	uint32_t color_sizes[MAX_COLORS + 1] = {};
+
+	body_colors.clear();
+	constraint_colors.resize(constraint_count);
+
+	for (uint32_t constraint_index = 0; constraint_index < constraint_count; ++constraint_index) {
+		const GodotConstraint2D *constraint = p_constraint_island[constraint_index];
+		GodotBody2D **bodies = constraint->get_body_ptr();
+
+		uint64_t used_colors = 0;
+		for (int i = 0; i < constraint->get_body_count(); i++) {
+			if (bodies[i]->get_mode() > PhysicsServer2D::BODY_MODE_KINEMATIC) {
+				const uint64_t *body_used_colors = body_colors.getptr(bodies[i]);
+				if (body_used_colors) {
+					used_colors |= *body_used_colors;
+				}
+			}
+		}
+
+		uint32_t color = 0;
+		while (color < MAX_COLORS && (used_colors & (uint64_t(1) << color))) {
+			color++;
+		}
+
+		if (color < MAX_COLORS) {
+			for (int i = 0; i < constraint->get_body_count(); i++) {
+				if (bodies[i]->get_mode() > PhysicsServer2D::BODY_MODE_KINEMATIC) {
+					uint64_t *body_used_colors = body_colors.getptr(bodies[i]);
+					if (body_used_colors) {
+						*body_used_colors |= uint64_t(1) << color;
+					} else {
+						body_colors.insert(bodies[i], uint64_t(1) << color);
+					}
+				}
+			}
+		}
+
+		constraint_colors[constraint_index] = color;
+		color_sizes[color]++;
+	}
+
+	color_offsets.resize(MAX_COLORS + 2);
+	color_offsets[0] = 0;
+	for (uint32_t color = 0; color <= MAX_COLORS; color++) {
+		color_offsets[color + 1] = color_offsets[color] + color_sizes[color];
+	}
+
+	// Sort by color, keeping the original order within each color.
+	colored_constraints.resize(constraint_count);
+	for (uint32_t color = 0; color <= MAX_COLORS; color++) {
+		color_sizes[color] = color_offsets[color];
+	}
+	for (uint32_t constraint_index = 0; constraint_index < constraint_count; ++constraint_index) {
+		colored_constraints[color_sizes[constraint_colors[constraint_index]]++] = p_constraint_island[constraint_index];
+	}
+}
+
+void GodotStep2D::_solve_colored_constraint(uint32_t p_index, uint32_t p_color_begin) const {
+	colored_constraints[p_color_begin + p_index]->solve(delta);
+}
+
+void GodotStep2D::_solve_large_island(uint32_t p_island_index) {
+	_color_constraints(constraint_islands[p_island_index]);
+
+	for (int i = 0; i < iterations; i++) {
+		for (uint32_t color = 0; color <= MAX_COLORS; color++) {
+			uint32_t color_begin = color_offsets[color];
+			uint32_t color_end = color_offsets[color + 1];
+
+			if (color < MAX_COLORS && color_end - color_begin >= COLOR_PARALLEL_MIN_CONSTRAINTS) {
+				WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &GodotStep2D::_solve_colored_constraint, color_begin, color_end - color_begin, -1, true, SNAME("Physics2DConstraintSolveColor"));
+				WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+			} else {
+				for (uint32_t constraint_index = color_begin; constraint_index < color_end; ++constraint_index) {
+					colored_constraints[constraint_index]->solve(delta);
+				}
+			}
+		}
+	}
+}
+
 void GodotStep2D::_check_suspend(LocalVector<GodotBody2D *> &p_body_island) const {
 	bool can_sleep = true;
 
@@ -263,9 +394,16 @@ void GodotStep2D::step(GodotSpace2D *p_space, real_t p_delta) {
 
 	// WARNING: `_solve_island` modifies the constraint islands for optimization purpose,
 	// their content is not reliable after these calls and shouldn't be used anymore.
-	group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &GodotStep2D::_solve_island, nullptr, island_count, -1, true, SNAME("Physics2DConstraintSolveIslands"));
+	_batch_islands(island_count);
+
+	group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &GodotStep2D::_solve_island_batch, nullptr, island_batches.size(), -1, true, SNAME("Physics2DConstraintSolveIslands"));
 	WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
 
+	// Large islands go wide on their own, one at a time.
+	for (uint32_t island_index : large_islands) {
+		_solve_large_island(island_index);
+	}
+
 	{ //profile
 		profile_endtime = OS::get_singleton()->get_ticks_usec();
 		p_space->set_elapsed_time(GodotSpace2D::ELAPSED_TIME_SOLVE_CONSTRAINTS, profile_endtime - profile_begtime);
@@ -34,6 +34,7 @@
 
 #include "godot_space_2d.h"
 
+#include "core/templates/hash_map.h"
 #include "core/templates/local_vector.h"
 
 class GodotStep2D {
@@ -46,10 +47,25 @@ class GodotStep2D {
 	LocalVector<LocalVector<GodotConstraint2D *>> constraint_islands;
 	LocalVector<GodotConstraint2D *> all_constraints;
 
+	// Small islands are solved in batches, large ones are split by graph coloring.
+	LocalVector<uint32_t> small_islands;
+	LocalVector<uint32_t> island_batches; // End of each batch in small_islands.
+	LocalVector<uint32_t> large_islands;
+
+	LocalVector<GodotConstraint2D *> colored_constraints; // Constraints of the large island being solved, sorted by color.
+	LocalVector<uint32_t> constraint_colors;
+	LocalVector<uint32_t> color_offsets; // Start of each color in colored_constraints, followed by the end.
+	HashMap<const GodotBody2D *, uint64_t> body_colors;
+
 	void _populate_island(GodotBody2D *p_body, LocalVector<GodotBody2D *> &p_body_island, LocalVector<GodotConstraint2D *> &p_constraint_island);
 	void _setup_constraint(uint32_t p_constraint_index, void *p_userdata = nullptr);
 	void _pre_solve_island(LocalVector<GodotConstraint2D *> &p_constraint_island) const;
 	void _solve_island(uint32_t p_island_index, void *p_userdata = nullptr) const;
+	void _batch_islands(uint32_t p_island_count);
+	void _solve_island_batch(uint32_t p_batch_index, void *p_userdata = nullptr) const;
+	void _color_constraints(const LocalVector<GodotConstraint2D *> &p_constraint_island);
+	void _solve_colored_constraint(uint32_t p_index, uint32_t p_color_begin) const;
+	void _solve_large_island(uint32_t p_island_index);
 	void _check_suspend(LocalVector<GodotBody2D *> &p_body_island) const;
 
 public:
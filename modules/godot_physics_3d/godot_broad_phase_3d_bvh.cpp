@@ -127,4 +127,6 @@ GodotBroadPhase3D *GodotBroadPhase3DBVH::_create() {
 GodotBroadPhase3DBVH::GodotBroadPhase3DBVH() {
 	bvh.set_pair_callback(_pair_callback, this);
 	bvh.set_unpair_callback(_unpair_callback, this);
+	// Pairs are created in the same order either way, so the simulation stays deterministic.
+	bvh.params_set_threaded_pairing(true);
 }
@@ -34,6 +34,7 @@
 
 #include "godot_joint_3d.h"
 
+#include "core/debugger/trace_profiler.h"
 #include "core/object/worker_thread_pool.h"
 #include "core/os/os.h"
 
@@ -185,6 +186,8 @@ void GodotStep3D::_check_suspend(const LocalVector<GodotBody3D *> &p_body_island
 }
 
 void GodotStep3D::step(GodotSpace3D *p_space, real_t p_delta) {
+	TRACE_ZONE("GodotStep3D::step");
+
 	p_space->lock(); // can't access space during this
 
 	p_space->setup(); //update inertias, etc
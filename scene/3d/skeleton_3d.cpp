@@ -33,6 +33,8 @@
 #include "skeleton_3d.h"
 #include "skeleton_3d.compat.inc"
 
+#include "core/config/project_settings.h"
+#include "core/object/worker_thread_pool.h"
 #include "scene/3d/skeleton_modifier_3d.h"
 #if !defined(DISABLE_DEPRECATED) && !defined(PHYSICS_3D_DISABLED)
 #include "scene/3d/physics/physical_bone_simulator_3d.h"
@@ -336,118 +338,255 @@ void Skeleton3D::_notification(int p_what) {
 		} break;
 #endif // TOOLS_ENABLED
 		case NOTIFICATION_UPDATE_SKELETON: {
-			// Update bone transforms to apply unprocessed poses.
-			force_update_all_dirty_bones();
+			if (_begin_skeleton_update()) {
+				_update_skin_palettes();
+				_end_skeleton_update();
+			}
+		} break;
+		case NOTIFICATION_INTERNAL_PROCESS: {
+			advance(get_process_delta_time());
+		} break;
+		case NOTIFICATION_INTERNAL_PHYSICS_PROCESS: {
+			advance(get_physics_process_delta_time());
+		} break;
+	}
+}
 
-			updating = true;
+bool Skeleton3D::_begin_skeleton_update() {
+	// Update bone transforms to apply unprocessed poses.
+	force_update_all_dirty_bones();
 
-			Bone *bonesptr = bones.ptr();
-			int len = bones.size();
+	updating = true;
 
-			thread_local LocalVector<bool> bone_global_pose_dirty_backup;
+	Bone *bonesptr = bones.ptr();
+	int len = bones.size();
 
-			// Process modifiers.
+	// Process modifiers.
 
-			thread_local LocalVector<BonePoseBackup> bones_backup;
-			_find_modifiers();
-			if (!modifiers.is_empty()) {
-				bones_backup.resize(bones.size());
-				// Store unmodified bone poses.
-				for (uint32_t i = 0; i < bones.size(); i++) {
-					bones_backup[i].save(bonesptr[i]);
-				}
-				// Store dirty flags for global bone poses.
-				bone_global_pose_dirty_backup = bone_global_pose_dirty;
+	_find_modifiers();
+	if (!modifiers.is_empty()) {
+		bones_backup.resize(bones.size());
+		// Store unmodified bone poses.
+		for (uint32_t i = 0; i < bones.size(); i++) {
+			bones_backup[i].save(bonesptr[i]);
+		}
+		// Store dirty flags for global bone poses.
+		bone_global_pose_dirty_backup = bone_global_pose_dirty;
+
+		if (update_flags & UPDATE_FLAG_MODIFIER) {
+			_process_modifiers();
+		}
+	}
+
+	// Abort if pose is not changed.
+	if (!(update_flags & UPDATE_FLAG_POSE)) {
+		updating = false;
+		update_flags = UPDATE_FLAG_NONE;
+		return false;
+	}
+
+	emit_signal(SceneStringName(skeleton_updated));
 
-				if (update_flags & UPDATE_FLAG_MODIFIER) {
-					_process_modifiers();
+	// Update skin bindings.
+	for (SkinReference *E : skin_bindings) {
+		const Skin *skin = E->skin.operator->();
+		RID skeleton = E->skeleton;
+		uint32_t bind_count = skin->get_bind_count();
+
+		if (E->bind_count != bind_count) {
+			RS::get_singleton()->skeleton_allocate_data(skeleton, bind_count);
+			E->bind_count = bind_count;
+			E->skin_bone_indices.resize(bind_count);
+			E->skin_bone_indices_ptrs = E->skin_bone_indices.ptrw();
+		}
+		E->skin_palette.resize(bind_count);
+
+		if (E->skeleton_version != version) {
+			for (uint32_t i = 0; i < bind_count; i++) {
+				StringName bind_name = skin->get_bind_name(i);
+
+				if (bind_name != StringName()) {
+					// Bind name used, use this.
+					bool found = false;
+					for (int j = 0; j < len; j++) {
+						if (bonesptr[j].name == bind_name) {
+							E->skin_bone_indices_ptrs[i] = j;
+							found = true;
+							break;
+						}
+					}
+
+					if (!found) {
+						ERR_PRINT("Skin bind #" + itos(i) + " contains named bind '" + String(bind_name) + "' but Skeleton3D has no bone by that name.");
+						E->skin_bone_indices_ptrs[i] = 0;
+					}
+				} else if (skin->get_bind_bone(i) >= 0) {
+					int bind_index = skin->get_bind_bone(i);
+					if (bind_index >= len) {
+						ERR_PRINT("Skin bind #" + itos(i) + " contains bone index bind: " + itos(bind_index) + " , which is greater than the skeleton bone count: " + itos(len) + ".");
+						E->skin_bone_indices_ptrs[i] = 0;
+					} else {
+						E->skin_bone_indices_ptrs[i] = bind_index;
+					}
+				} else {
+					ERR_PRINT("Skin bind #" + itos(i) + " does not contain a name nor a bone index.");
+					E->skin_bone_indices_ptrs[i] = 0;
 				}
 			}
 
-			// Abort if pose is not changed.
-			if (!(update_flags & UPDATE_FLAG_POSE)) {
-				updating = false;
-				update_flags = UPDATE_FLAG_NONE;
-				return;
-			}
+			E->skeleton_version = version;
+		}
+	}
 
-			emit_signal(SceneStringName(skeleton_updated));
+	return true;
+}
 
-			// Update skins.
-			RenderingServer *rs = RenderingServer::get_singleton();
-			for (SkinReference *E : skin_bindings) {
-				const Skin *skin = E->skin.operator->();
-				RID skeleton = E->skeleton;
-				uint32_t bind_count = skin->get_bind_count();
+void Skeleton3D::_update_skin_palettes() const {
+	// Only reads the bones and skins, so it's safe to run on a worker thread during batched updates.
+	const Bone *bonesptr = bones.ptr();
+	uint32_t len = bones.size();
 
-				if (E->bind_count != bind_count) {
-					RS::get_singleton()->skeleton_allocate_data(skeleton, bind_count);
-					E->bind_count = bind_count;
-					E->skin_bone_indices.resize(bind_count);
-					E->skin_bone_indices_ptrs = E->skin_bone_indices.ptrw();
-				}
+	for (SkinReference *E : skin_bindings) {
+		const Skin *skin = E->skin.operator->();
+		Transform3D *palette = E->skin_palette.ptr();
 
-				if (E->skeleton_version != version) {
-					for (uint32_t i = 0; i < bind_count; i++) {
-						StringName bind_name = skin->get_bind_name(i);
-
-						if (bind_name != StringName()) {
-							// Bind name used, use this.
-							bool found = false;
-							for (int j = 0; j < len; j++) {
-								if (bonesptr[j].name == bind_name) {
-									E->skin_bone_indices_ptrs[i] = j;
-									found = true;
-									break;
-								}
-							}
-
-							if (!found) {
-								ERR_PRINT("Skin bind #" + itos(i) + " contains named bind '" + String(bind_name) + "' but Skeleton3D has no bone by that name.");
-								E->skin_bone_indices_ptrs[i] = 0;
-							}
-						} else if (skin->get_bind_bone(i) >= 0) {
-							int bind_index = skin->get_bind_bone(i);
-							if (bind_index >= len) {
-								ERR_PRINT("Skin bind #" + itos(i) + " contains bone index bind: " + itos(bind_index) + " , which is greater than the skeleton bone count: " + itos(len) + ".");
-								E->skin_bone_indices_ptrs[i] = 0;
-							} else {
-								E->skin_bone_indices_ptrs[i] = bind_index;
-							}
-						} else {
-							ERR_PRINT("Skin bind #" + itos(i) + " does not contain a name nor a bone index.");
-							E->skin_bone_indices_ptrs[i] = 0;
-						}
-					}
+		for (uint32_t i = 0; i < E->bind_count; i++) {
+			uint32_t bone_index = E->skin_bone_indices_ptrs[i];
+			ERR_CONTINUE(bone_index >= len);
+			palette[i] = bonesptr[bone_index].global_pose * skin->get_bind_pose(i);
+		}
+	}
+}
 
-					E->skeleton_version = version;
-				}
+void Skeleton3D::_end_skeleton_update() {
+	// Update skins.
+	RenderingServer *rs = RenderingServer::get_singleton();
+	for (const SkinReference *E : skin_bindings) {
+		for (uint32_t i = 0; i < E->bind_count; i++) {
+			rs->skeleton_bone_set_transform(E->skeleton, i, E->skin_palette[i]);
+		}
+	}
 
-				for (uint32_t i = 0; i < bind_count; i++) {
-					uint32_t bone_index = E->skin_bone_indices_ptrs[i];
-					ERR_CONTINUE(bone_index >= (uint32_t)len);
-					rs->skeleton_bone_set_transform(skeleton, i, bonesptr[bone_index].global_pose * skin->get_bind_pose(i));
-				}
-			}
+	if (!modifiers.is_empty()) {
+		// Restore unmodified bone poses.
+		for (uint32_t i = 0; i < bones.size(); i++) {
+			bones_backup[i].restore(bones[i]);
+		}
+		// Restore dirty flags for global bone poses.
+		bone_global_pose_dirty = bone_global_pose_dirty_backup;
+	}
 
-			if (!modifiers.is_empty()) {
-				// Restore unmodified bone poses.
-				for (uint32_t i = 0; i < bones.size(); i++) {
-					bones_backup[i].restore(bones[i]);
-				}
-				// Restore dirty flags for global bone poses.
-				bone_global_pose_dirty = bone_global_pose_dirty_backup;
-			}
+	updating = false;
+	update_flags = UPDATE_FLAG_NONE;
+}
 
-			updating = false;
-			update_flags = UPDATE_FLAG_NONE;
-		} break;
-		case NOTIFICATION_INTERNAL_PROCESS: {
-			advance(get_process_delta_time());
-		} break;
-		case NOTIFICATION_INTERNAL_PHYSICS_PROCESS: {
-			advance(get_physics_process_delta_time());
-		} break;
+/* -------------------------------------------- */
+/* -- Batched updates ------------------------- */
+/* -------------------------------------------- */
+
+// When enabled, the skeletons updated on the main thread are gathered and updated together at the end of the frame.
+// Global poses and skin palettes are computed on the WorkerThreadPool, one skeleton per task; modifiers, signals
+// and uploading the palettes to the RenderingServer still happen on the main thread, one skeleton at a time.
+
+LocalVector<ObjectID> Skeleton3D::update_batch;
+
+bool Skeleton3D::_can_update_in_batch() const {
+	if (!GLOBAL_GET_CACHED(bool, "animation/thread_model/skeleton_use_multiple_threads")) {
+		return false;
+	}
+	return Thread::is_main_thread() && is_accessible_from_caller_thread();
+}
+
+void Skeleton3D::_queue_update_batch() {
+	if (update_batch.is_empty()) {
+		callable_mp_static(&Skeleton3D::_process_update_batch).call_deferred();
+	}
+	update_batch.push_back(get_instance_id());
+}
+
+void Skeleton3D::_update_batch_global_poses(void *p_skeletons, uint32_t p_index) {
+	const Skeleton3D *skeleton = (*(LocalVector<Skeleton3D *> *)p_skeletons)[p_index];
+	if (skeleton->dirty) {
+		skeleton->_update_bone_global_poses();
+	}
+}
+
+void Skeleton3D::_update_batch_skin_palettes(void *p_skeletons, uint32_t p_index) {
+	(*(LocalVector<Skeleton3D *> *)p_skeletons)[p_index]->_update_skin_palettes();
+}
+
+void Skeleton3D::_process_update_batch() {
+	LocalVector<ObjectID> batch;
+	SWAP(batch, update_batch);
+
+	// Skeletons are looked up again before every main thread pass, since scripts run there may free them.
+
+	// Rebuilding the process order emits a signal, so it must be done before going wide.
+	for (const ObjectID &id : batch) {
+		Skeleton3D *skeleton = ObjectDB::get_instance<Skeleton3D>(id);
+		if (skeleton) {
+			skeleton->_update_process_order();
+		}
+	}
+
+	LocalVector<Skeleton3D *> skeletons;
+	for (const ObjectID &id : batch) {
+		Skeleton3D *skeleton = ObjectDB::get_instance<Skeleton3D>(id);
+		if (skeleton) {
+			skeletons.push_back(skeleton);
+		}
+	}
+	if (skeletons.is_empty()) {
+		return;
+	}
+
+	WorkerThreadPool::GroupID group = WorkerThreadPool::get_singleton()->add_native_group_task(&Skeleton3D::_update_batch_global_poses, &skeletons, skeletons.size(), -1, true, SNAME("Skeleton3DGlobalPoses"));
+	WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group);
+
+	// The global poses are up to date, so they aren't computed again when beginning the update.
+	// All skeletons are marked first, so bones changed by the signals make their skeleton dirty again.
+	LocalVector<ObjectID> updated_poses;
+	LocalVector<bool> updated_rests;
+	for (Skeleton3D *skeleton : skeletons) {
+		if (skeleton->dirty) {
+			updated_poses.push_back(skeleton->get_instance_id());
+			updated_rests.push_back(skeleton->rest_dirty);
+			skeleton->rest_dirty = false;
+			skeleton->dirty = false;
+		}
+	}
+	for (uint32_t i = 0; i < updated_poses.size(); i++) {
+		Skeleton3D *skeleton = ObjectDB::get_instance<Skeleton3D>(updated_poses[i]);
+		if (skeleton) {
+			skeleton->_emit_bone_transforms_updated(updated_rests[i]);
+		}
+	}
+
+	// Runs the modifiers and emits the remaining signals. Bones changed meanwhile are recomputed here.
+	LocalVector<ObjectID> updated;
+	for (const ObjectID &id : batch) {
+		Skeleton3D *skeleton = ObjectDB::get_instance<Skeleton3D>(id);
+		if (skeleton && skeleton->_begin_skeleton_update()) {
+			updated.push_back(id);
+		}
+	}
+
+	skeletons.clear();
+	for (const ObjectID &id : updated) {
+		Skeleton3D *skeleton = ObjectDB::get_instance<Skeleton3D>(id);
+		if (skeleton) {
+			skeletons.push_back(skeleton);
+		}
+	}
+	if (skeletons.is_empty()) {
+		return;
+	}
+
+	group = WorkerThreadPool::get_singleton()->add_native_group_task(&Skeleton3D::_update_batch_skin_palettes, &skeletons, skeletons.size(), -1, true, SNAME("Skeleton3DSkinPalettes"));
+	WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group);
+
+	for (Skeleton3D *skeleton : skeletons) {
+		skeleton->_end_skeleton_update();
 	}
 }
 
@@ -971,7 +1110,12 @@ void Skeleton3D::_update_deferred(UpdateFlag p_update_flag) {
 		}
 #endif //TOOLS_ENABLED
 		if (update_flags == UPDATE_FLAG_NONE && !updating) {
-			notify_deferred_thread_group(NOTIFICATION_UPDATE_SKELETON); // It must never be called more than once in a single frame.
+			// It must never be called more than once in a single frame.
+			if (_can_update_in_batch()) {
+				_queue_update_batch();
+			} else {
+				notify_deferred_thread_group(NOTIFICATION_UPDATE_SKELETON);
+			}
 		}
 		update_flags |= p_update_flag;
 	}
@@ -1087,23 +1231,31 @@ void Skeleton3D::force_update_all_bone_transforms() {
 }
 
 void Skeleton3D::_force_update_all_bone_transforms() const {
-	_update_process_order();
-	for (int i = 0; i < parentless_bones.size(); i++) {
-		_force_update_bone_children_transforms(parentless_bones[i]);
-	}
-	if (rest_dirty) {
-		rest_dirty = false;
+	_update_bone_global_poses();
+	const bool rest_updated = rest_dirty;
+	rest_dirty = false;
+	dirty = false;
+	_emit_bone_transforms_updated(rest_updated);
+}
+
+void Skeleton3D::_emit_bone_transforms_updated(bool p_rest_updated) const {
+	if (p_rest_updated) {
 		const_cast<Skeleton3D *>(this)->emit_signal(SNAME("rest_updated"));
-	} else {
-		rest_dirty = false;
 	}
-	dirty = false;
 	if (updating) {
 		return;
 	}
 	const_cast<Skeleton3D *>(this)->emit_signal(SceneStringName(pose_updated));
 }
 
+void Skeleton3D::_update_bone_global_poses() const {
+	// Doesn't emit any signal, so it's safe to run on a worker thread if the process order is up to date.
+	_update_process_order();
+	for (int i = 0; i < parentless_bones.size(); i++) {
+		_force_update_bone_children_transforms(parentless_bones[i]);
+	}
+}
+
 void Skeleton3D::force_update_bone_children_transforms(int p_bone_idx) {
 	_force_update_bone_children_transforms(p_bone_idx);
 }
@@ -51,6 +51,7 @@ class SkinReference : public RefCounted {
 	uint64_t skeleton_version = 0;
 	Vector<uint32_t> skin_bone_indices;
 	uint32_t *skin_bone_indices_ptrs = nullptr;
+	LocalVector<Transform3D> skin_palette; // Final bone transforms, uploaded to the RenderingServer.
 
 protected:
 	static void _bind_methods();
@@ -159,6 +160,21 @@ private:
 		}
 	};
 
+	LocalVector<BonePoseBackup> bones_backup;
+	LocalVector<bool> bone_global_pose_dirty_backup;
+
+	bool _begin_skeleton_update();
+	void _update_skin_palettes() const;
+	void _end_skeleton_update();
+
+	// Batched updates, see the project setting animation/thread_model/skeleton_use_multiple_threads.
+	static LocalVector<ObjectID> update_batch;
+	bool _can_update_in_batch() const;
+	void _queue_update_batch();
+	static void _process_update_batch();
+	static void _update_batch_global_poses(void *p_skeletons, uint32_t p_index);
+	static void _update_batch_skin_palettes(void *p_skeletons, uint32_t p_index);
+
 	HashSet<SkinReference *> skin_bindings;
 	void _skin_changed();
 
@@ -199,6 +215,8 @@ private:
 	void _make_bone_global_poses_dirty() const;
 	void _make_bone_global_pose_subtree_dirty(int p_bone) const;
 	void _update_bone_global_pose(int p_bone) const;
+	void _update_bone_global_poses() const;
+	void _emit_bone_transforms_updated(bool p_rest_updated) const;
 
 #ifndef DISABLE_DEPRECATED
 	void _add_bone_bind_compat_88791(const String &p_name);
@@ -35,6 +35,7 @@
 
 #include "core/config/engine.h"
 #include "core/config/project_settings.h"
+#include "core/object/worker_thread_pool.h"
 #include "core/string/string_name.h"
 #include "scene/2d/audio_stream_player_2d.h"
 #include "scene/animation/animation_player.h"
@@ -998,6 +999,87 @@ void AnimationMixer::_process_animation(double p_delta, bool p_update_only) {
 	clear_animation_instances();
 }
 
+/* -------------------------------------------- */
+/* -- Batched blending ------------------------ */
+/* -------------------------------------------- */
+
+// When enabled, the mixers processed in the same frame are gathered and blended together at the end of it.
+// Only the evaluation of the thread-safe tracks is spread across the WorkerThreadPool; the rest, including
+// applying the results to the scene, still happens on the main thread, one mixer at a time.
+
+LocalVector<ObjectID> AnimationMixer::blend_batch[BLEND_BATCH_MAX];
+
+bool AnimationMixer::_can_blend_in_batch() const {
+	if (!GLOBAL_GET_CACHED(bool, "animation/thread_model/blend_use_multiple_threads")) {
+		return false;
+	}
+	// Scripts overriding the key value post-processing can't be assumed to be thread-safe.
+	return Thread::is_main_thread() && !GDVIRTUAL_IS_OVERRIDDEN(_post_process_key_value);
+}
+
+void AnimationMixer::_queue_blend_batch(BlendBatch p_batch, double p_delta) {
+	if (blend_batch[p_batch].is_empty()) {
+		callable_mp_static(&AnimationMixer::_process_blend_batch).call_deferred(p_batch);
+	}
+	blend_batch_delta = p_delta;
+	blend_batch[p_batch].push_back(get_instance_id());
+}
+
+void AnimationMixer::_blend_batch_thread_safe_tracks(void *p_mixers, uint32_t p_index) {
+	AnimationMixer *mixer = (*(LocalVector<AnimationMixer *> *)p_mixers)[p_index];
+	mixer->_blend_process(mixer->blend_batch_delta, false, BLEND_TRACKS_THREAD_SAFE);
+}
+
+void AnimationMixer::_process_blend_batch(int p_batch) {
+	LocalVector<ObjectID> batch;
+	SWAP(batch, blend_batch[p_batch]);
+
+	// Mixers are looked up again before every main thread pass, since scripts run there may free them.
+
+	// Playback and blend tree evaluation may call into scripts, so it's done on the main thread.
+	LocalVector<ObjectID> blending;
+	for (const ObjectID &id : batch) {
+		AnimationMixer *mixer = ObjectDB::get_instance<AnimationMixer>(id);
+		if (!mixer || !mixer->active) {
+			continue;
+		}
+		mixer->_blend_init();
+		if (mixer->_blend_pre_process(mixer->blend_batch_delta, mixer->track_count, mixer->track_map)) {
+			mixer->_blend_capture(mixer->blend_batch_delta);
+			mixer->_blend_calc_total_weight();
+			blending.push_back(id);
+		} else {
+			mixer->clear_animation_instances();
+		}
+	}
+
+	LocalVector<AnimationMixer *> mixers;
+	for (const ObjectID &id : blending) {
+		AnimationMixer *mixer = ObjectDB::get_instance<AnimationMixer>(id);
+		if (mixer) {
+			mixers.push_back(mixer);
+		}
+	}
+	if (mixers.is_empty()) {
+		return;
+	}
+
+	WorkerThreadPool::GroupID group = WorkerThreadPool::get_singleton()->add_native_group_task(&AnimationMixer::_blend_batch_thread_safe_tracks, &mixers, mixers.size(), -1, true, SNAME("AnimationMixerBlend"));
+	WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group);
+
+	for (const ObjectID &id : blending) {
+		AnimationMixer *mixer = ObjectDB::get_instance<AnimationMixer>(id);
+		if (!mixer) {
+			continue;
+		}
+		mixer->_blend_process(mixer->blend_batch_delta, false, BLEND_TRACKS_MAIN_THREAD);
+		mixer->_blend_apply();
+		mixer->_blend_post_process();
+		mixer->emit_signal(SNAME("mixer_applied"));
+		mixer->clear_animation_instances();
+	}
+}
+
 Variant AnimationMixer::_post_process_key_value(const Ref<Animation> &p_anim, int p_track, Variant &p_value, ObjectID p_object_id, int p_object_sub_idx) {
 #ifndef _3D_DISABLED
 	switch (p_anim->track_get_type(p_track)) {
@@ -1167,7 +1249,7 @@ void AnimationMixer::_blend_calc_total_weight() {
 	}
 }
 
-void AnimationMixer::_blend_process(double p_delta, bool p_update_only) {
+void AnimationMixer::_blend_process(double p_delta, bool p_update_only, BlendTracks p_tracks) {
 	// Apply value/transform/blend/bezier blends to track caches and execute method/audio/animation tracks.
 #ifdef TOOLS_ENABLED
 	bool can_call = is_inside_tree() && !Engine::get_singleton()->is_editor_hint();
@@ -1190,6 +1272,12 @@ void AnimationMixer::_blend_process(double p_delta, bool p_update_only) {
 		bool calc_root = !seeked || is_external_seeking;
 #endif // _3D_DISABLED
 		ERR_CONTINUE_EDMSG(!animation_track_num_to_track_cache.has(a), "No animation in cache.");
+		// Compressed animations sample all their transform and blend shape tracks at once, which is much cheaper than doing it track by track.
+		const Animation::CompressedTrackSamples *samples = nullptr;
+		if (p_tracks != BLEND_TRACKS_MAIN_THREAD && a->is_compressed()) {
+			a->sample_compressed_tracks(time, compressed_track_samples);
+			samples = &compressed_track_samples;
+		}
 		LocalVector<TrackCache *> &track_num_to_track_cache = animation_track_num_to_track_cache[a];
 		const Vector<Animation::Track *> tracks = a->get_tracks();
 		Animation::Track *const *tracks_ptr = tracks.ptr();
@@ -1216,6 +1304,12 @@ void AnimationMixer::_blend_process(double p_delta, bool p_update_only) {
 				blend = blend / track->total_weight;
 			}
 			Animation::TrackType ttype = animation_track->type;
+			if (p_tracks != BLEND_TRACKS_ALL) {
+				bool thread_safe = ttype == Animation::TYPE_POSITION_3D || ttype == Animation::TYPE_ROTATION_3D || ttype == Animation::TYPE_SCALE_3D || ttype == Animation::TYPE_BLEND_SHAPE;
+				if (thread_safe != (p_tracks == BLEND_TRACKS_THREAD_SAFE)) {
+					continue;
+				}
+			}
 			track->root_motion = root_motion_track == animation_track->path;
 			switch (ttype) {
 				case Animation::TYPE_POSITION_3D: {
@@ -1352,7 +1446,7 @@ void AnimationMixer::_blend_process(double p_delta, bool p_update_only) {
 					}
 					{
 						Vector3 loc;
-						Error err = a->try_position_track_interpolate(i, time, &loc);
+						Error err = samples ? samples->get_vector3(i, &loc) : a->try_position_track_interpolate(i, time, &loc);
 						if (err != OK) {
 							continue;
 						}
@@ -1440,7 +1534,7 @@ void AnimationMixer::_blend_process(double p_delta, bool p_update_only) {
 					}
 					{
 						Quaternion rot;
-						Error err = a->try_rotation_track_interpolate(i, time, &rot);
+						Error err = samples ? samples->get_quaternion(i, &rot) : a->try_rotation_track_interpolate(i, time, &rot);
 						if (err != OK) {
 							continue;
 						}
@@ -1528,7 +1622,7 @@ void AnimationMixer::_blend_process(double p_delta, bool p_update_only) {
 					}
 					{
 						Vector3 scale;
-						Error err = a->try_scale_track_interpolate(i, time, &scale);
+						Error err = samples ? samples->get_vector3(i, &scale) : a->try_scale_track_interpolate(i, time, &scale);
 						if (err != OK) {
 							continue;
 						}
@@ -1544,7 +1638,7 @@ void AnimationMixer::_blend_process(double p_delta, bool p_update_only) {
 					}
 					TrackCacheBlendShape *t = static_cast<TrackCacheBlendShape *>(track);
 					float value;
-					Error err = a->try_blend_shape_track_interpolate(i, time, &value);
+					Error err = samples ? samples->get_float(i, &value) : a->try_blend_shape_track_interpolate(i, time, &value);
 					//ERR_CONTINUE(err!=OK); //used for testing, should be removed
 					if (err != OK) {
 						continue;
@@ -2354,13 +2448,21 @@ void AnimationMixer::_notification(int p_what) {
 
 		case NOTIFICATION_INTERNAL_PROCESS: {
 			if (active && callback_mode_process == ANIMATION_CALLBACK_MODE_PROCESS_IDLE) {
-				_process_animation(get_process_delta_time());
+				if (_can_blend_in_batch()) {
+					_queue_blend_batch(BLEND_BATCH_IDLE, get_process_delta_time());
+				} else {
+					_process_animation(get_process_delta_time());
+				}
 			}
 		} break;
 
 		case NOTIFICATION_INTERNAL_PHYSICS_PROCESS: {
 			if (active && callback_mode_process == ANIMATION_CALLBACK_MODE_PROCESS_PHYSICS) {
-				_process_animation(get_physics_process_delta_time());
+				if (_can_blend_in_batch()) {
+					_queue_blend_batch(BLEND_BATCH_PHYSICS, get_physics_process_delta_time());
+				} else {
+					_process_animation(get_physics_process_delta_time());
+				}
 			}
 		} break;
 
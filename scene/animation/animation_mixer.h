@@ -324,6 +324,7 @@ protected:
 
 	/* ---- Blending processor ---- */
 	LocalVector<AnimationInstance> animation_instances;
+	Animation::CompressedTrackSamples compressed_track_samples; // Scratch space for sampling compressed animations in _blend_process().
 	AHashMap<NodePath, int> track_map;
 	int track_count = 0;
 	bool deterministic = false;
@@ -364,11 +365,17 @@ protected:
 	Variant post_process_key_value(const Ref<Animation> &p_anim, int p_track, Variant p_value, ObjectID p_object_id, int p_object_sub_idx = -1);
 	GDVIRTUAL5RC(Variant, _post_process_key_value, Ref<Animation>, int, Variant, ObjectID, int);
 
+	enum BlendTracks {
+		BLEND_TRACKS_ALL,
+		BLEND_TRACKS_THREAD_SAFE, // Position, rotation, scale and blend shape tracks, which only write to the track caches.
+		BLEND_TRACKS_MAIN_THREAD, // Everything else.
+	};
+
 	void _blend_init();
 	virtual bool _blend_pre_process(double p_delta, int p_track_count, const AHashMap<NodePath, int> &p_track_map);
 	virtual void _blend_capture(double p_delta);
 	void _blend_calc_total_weight(); // For indeterministic blending.
-	void _blend_process(double p_delta, bool p_update_only = false);
+	void _blend_process(double p_delta, bool p_update_only = false, BlendTracks p_tracks = BLEND_TRACKS_ALL);
 	void _blend_apply();
 	virtual void _blend_post_process();
 	void _call_object(ObjectID p_object_id, const StringName &p_method, const Vector<Variant> &p_params, bool p_deferred);
@@ -393,6 +400,20 @@ protected:
 	} capture_cache;
 	void blend_capture(double p_delta); // To blend capture track with all other animations.
 
+	/* ---- Batched blending on the WorkerThreadPool ---- */
+	enum BlendBatch {
+		BLEND_BATCH_IDLE,
+		BLEND_BATCH_PHYSICS,
+		BLEND_BATCH_MAX,
+	};
+	static LocalVector<ObjectID> blend_batch[BLEND_BATCH_MAX];
+	double blend_batch_delta = 0.0;
+
+	bool _can_blend_in_batch() const;
+	void _queue_blend_batch(BlendBatch p_batch, double p_delta);
+	static void _process_blend_batch(int p_batch); // BlendBatch.
+	static void _blend_batch_thread_safe_tracks(void *p_mixers, uint32_t p_index);
+
 #ifndef DISABLE_DEPRECATED
 	virtual Variant _post_process_key_value_bind_compat_86687(const Ref<Animation> &p_anim, int p_track, Variant p_value, Object *p_object, int p_object_idx = -1);
 	static void _bind_compatibility_methods();
@@ -0,0 +1,191 @@
+/**************************************************************************/
+/*  scene_pool.cpp                                                        */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             REDOT ENGINE                               */
+/*                        https://redotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2024-present Redot Engine contributors                   */
+/*                                          (see REDOT_AUTHORS.md)        */
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include "scene_pool.h"
+
+Node *ScenePool::_instantiate(const Ref<PackedScene> &p_scene, Pool &p_pool) {
+	Node *node = p_scene->instantiate();
+	ERR_FAIL_NULL_V_MSG(node, nullptr, vformat("Failed to instantiate scene '%s' for the pool.", p_scene->get_path()));
+
+	if (!p_pool.has_baseline) {
+		// Every instance starts the same, so the first one gives the values for all of them.
+		_capture_baseline(node, node, p_pool);
+		p_pool.has_baseline = true;
+	}
+	return node;
+}
+
+void ScenePool::_capture_baseline(Node *p_root, Node *p_node, Pool &p_pool) {
+	NodeBaseline baseline;
+	baseline.path = p_root->get_path_to(p_node);
+
+	List<PropertyInfo> properties;
+	p_node->get_property_list(&properties);
+	for (const PropertyInfo &E : properties) {
+		if (!(E.usage & PROPERTY_USAGE_STORAGE) || E.name == CoreStringName(script)) {
+			continue;
+		}
+
+		bool valid = false;
+		Variant value = p_node->get(E.name, &valid);
+		// Resources may be local to each instance, so they are left as is.
+		if (!valid || value.get_type() == Variant::OBJECT) {
+			continue;
+		}
+		baseline.properties.push_back(Pair<StringName, Variant>(E.name, value.duplicate(true)));
+	}
+	p_pool.baseline.push_back(baseline);
+
+	for (int i = 0; i < p_node->get_child_count(); i++) {
+		_capture_baseline(p_root, p_node->get_child(i), p_pool);
+	}
+}
+
+void ScenePool::_reset(Node *p_root, const Pool &p_pool) {
+	for (const NodeBaseline &baseline : p_pool.baseline) {
+		Node *node = p_root->get_node_or_null(baseline.path);
+		if (!node) {
+			continue;
+		}
+
+		for (const Pair<StringName, Variant> &property : baseline.properties) {
+			if (node->get(property.first) != property.second) {
+				// Containers are copied, so changes made while in use don't leak into the baseline.
+				node->set(property.first, property.second.duplicate(true));
+			}
+		}
+		node->request_ready();
+	}
+}
+
+void ScenePool::set_max_size(int p_max_size) {
+	ERR_FAIL_COND(p_max_size < 0);
+	max_size = p_max_size;
+
+	for (KeyValue<Ref<PackedScene>, Pool> &E : pools) {
+		while ((int)E.value.available.size() > max_size) {
+			memdelete(E.value.available[E.value.available.size() - 1]);
+			E.value.available.resize(E.value.available.size() - 1);
+		}
+	}
+}
+
+int ScenePool::get_max_size() const {
+	return max_size;
+}
+
+void ScenePool::prewarm(const Ref<PackedScene> &p_scene, int p_count) {
+	ERR_FAIL_COND(p_scene.is_null());
+
+	Pool &pool = pools[p_scene];
+	const int count = MIN(p_count, max_size);
+	while ((int)pool.available.size() < count) {
+		Node *node = _instantiate(p_scene, pool);
+		ERR_FAIL_NULL(node);
+		pool.available.push_back(node);
+	}
+}
+
+Node *ScenePool::acquire(const Ref<PackedScene> &p_scene) {
+	ERR_FAIL_COND_V(p_scene.is_null(), nullptr);
+
+	Pool &pool = pools[p_scene];
+	Node *node = nullptr;
+	if (pool.available.is_empty()) {
+		node = _instantiate(p_scene, pool);
+		ERR_FAIL_NULL_V(node, nullptr);
+	} else {
+		node = pool.available[pool.available.size() - 1];
+		pool.available.resize(pool.available.size() - 1);
+	}
+
+	acquired[node->get_instance_id()] = p_scene;
+	return node;
+}
+
+bool ScenePool::release(Node *p_node) {
+	ERR_FAIL_NULL_V(p_node, false);
+
+	HashMap<ObjectID, Ref<PackedScene>>::Iterator E = acquired.find(p_node->get_instance_id());
+	ERR_FAIL_COND_V_MSG(!E, false, vformat("Node '%s' was not acquired from this pool.", p_node->get_name()));
+	ERR_FAIL_COND_V_MSG(p_node->is_queued_for_deletion(), false, vformat("Node '%s' is queued for deletion and can't be released to the pool.", p_node->get_name()));
+
+	if (p_node->get_parent()) {
+		p_node->get_parent()->remove_child(p_node);
+		// Fails while the parent is busy with its children, the node stays acquired then.
+		ERR_FAIL_COND_V_MSG(p_node->get_parent() != nullptr, false, vformat("Node '%s' couldn't be removed from its parent and can't be released to the pool.", p_node->get_name()));
+	}
+
+	Pool &pool = pools[E->value];
+	acquired.remove(E);
+
+	if ((int)pool.available.size() >= max_size) {
+		memdelete(p_node);
+		return true;
+	}
+
+	_reset(p_node, pool);
+	pool.available.push_back(p_node);
+	return true;
+}
+
+int ScenePool::get_available_count(const Ref<PackedScene> &p_scene) const {
+	const Pool *pool = pools.getptr(p_scene);
+	return pool ? pool->available.size() : 0;
+}
+
+void ScenePool::clear() {
+	for (KeyValue<Ref<PackedScene>, Pool> &E : pools) {
+		for (Node *node : E.value.available) {
+			memdelete(node);
+		}
+	}
+	pools.clear();
+	acquired.clear();
+}
+
+void ScenePool::_bind_methods() {
+	ClassDB::bind_method(D_METHOD("set_max_size", "max_size"), &ScenePool::set_max_size);
+	ClassDB::bind_method(D_METHOD("get_max_size"), &ScenePool::get_max_size);
+
+	ClassDB::bind_method(D_METHOD("prewarm", "scene", "count"), &ScenePool::prewarm);
+	ClassDB::bind_method(D_METHOD("acquire", "scene"), &ScenePool::acquire);
+	ClassDB::bind_method(D_METHOD("release", "node"), &ScenePool::release);
+	ClassDB::bind_method(D_METHOD("get_available_count", "scene"), &ScenePool::get_available_count);
+	ClassDB::bind_method(D_METHOD("clear"), &ScenePool::clear);
+
+	ADD_PROPERTY(PropertyInfo(Variant::INT, "max_size", PROPERTY_HINT_RANGE, "0,4096,1,or_greater"), "set_max_size", "get_max_size");
+}
+
+ScenePool::~ScenePool() {
+	clear();
+}
@@ -0,0 +1,76 @@
+/**************************************************************************/
+/*  scene_pool.h                                                          */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             REDOT ENGINE                               */
+/*                        https://redotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2024-present Redot Engine contributors                   */
+/*                                          (see REDOT_AUTHORS.md)        */
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+
+#include "scene/resources/packed_scene.h"
+
+// Keeps instances of packed scenes around once released, so spawning them again skips instantiation.
+class ScenePool : public RefCounted {
+	GDCLASS(ScenePool, RefCounted);
+
+	// Properties of a node right after instantiation, restored when its scene is released.
+	struct NodeBaseline {
+		NodePath path;
+		LocalVector<Pair<StringName, Variant>> properties;
+	};
+
+	struct Pool {
+		LocalVector<Node *> available;
+		LocalVector<NodeBaseline> baseline;
+		bool has_baseline = false;
+	};
+
+	int max_size = 64;
+	HashMap<Ref<PackedScene>, Pool> pools;
+	HashMap<ObjectID, Ref<PackedScene>> acquired;
+
+	Node *_instantiate(const Ref<PackedScene> &p_scene, Pool &p_pool);
+	void _capture_baseline(Node *p_root, Node *p_node, Pool &p_pool);
+	void _reset(Node *p_root, const Pool &p_pool);
+
+protected:
+	static void _bind_methods();
+
+public:
+	void set_max_size(int p_max_size);
+	int get_max_size() const;
+
+	void prewarm(const Ref<PackedScene> &p_scene, int p_count);
+	Node *acquire(const Ref<PackedScene> &p_scene);
+	bool release(Node *p_node);
+
+	int get_available_count(const Ref<PackedScene> &p_scene) const;
+	void clear();
+
+	~ScenePool();
+};
@@ -33,6 +33,7 @@
 #include "scene_tree.h"
 
 #include "core/config/project_settings.h"
+#include "core/debugger/trace_profiler.h"
 #include "core/input/input.h"
 #include "core/io/image_loader.h"
 #include "core/io/resource_loader.h"
@@ -1200,6 +1201,8 @@ void SceneTree::_process_groups_thread(uint32_t p_index, bool p_physics) {
 }
 
 void SceneTree::_process(bool p_physics) {
+	TRACE_ZONE("SceneTree::_process");
+
 	if (process_groups_dirty) {
 		{
 			// First, remove dirty groups.
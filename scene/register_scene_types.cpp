@@ -102,6 +102,7 @@
 #include "scene/main/missing_node.h"
 #include "scene/main/multiplayer_api.h"
 #include "scene/main/resource_preloader.h"
+#include "scene/main/scene_pool.h"
 #include "scene/main/scene_tree.h"
 #include "scene/main/shader_globals_override.h"
 #include "scene/main/status_indicator.h"
@@ -406,6 +407,9 @@ void register_scene_types() {
 
 	resource_loader_text.instantiate();
 	ResourceLoader::add_resource_format_loader(resource_loader_text, true);
+	if (GLOBAL_DEF("application/run/cache_text_resources_as_binary", false) && !Engine::get_singleton()->is_editor_hint() && !Engine::get_singleton()->is_project_manager_hint()) {
+		resource_loader_text->set_binary_cache_enabled(true);
+	}
 
 	if (GD_IS_CLASS_ENABLED(Shader)) {
 		resource_saver_shader.instantiate();
@@ -1163,6 +1167,7 @@ void register_scene_types() {
 
 	GDREGISTER_ABSTRACT_CLASS(SceneState);
 	GDREGISTER_CLASS(PackedScene);
+	GDREGISTER_CLASS(ScenePool);
 
 	GDREGISTER_CLASS(SceneTree);
 	GDREGISTER_ABSTRACT_CLASS(SceneTreeTimer); // sorry, you can't create it
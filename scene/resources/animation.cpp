@@ -35,6 +35,12 @@
 
 #include "core/io/marshalls.h"
 
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#elif defined(__ARM_NEON)
+#include <arm_neon.h>
+#endif
+
 bool Animation::_set(const StringName &p_name, const Variant &p_value) {
 	String prop_name = p_name;
 
@@ -5250,6 +5256,189 @@ void Animation::compress(uint32_t p_page_size, uint32_t p_fps, float p_split_tol
 #endif
 }
 
+int32_t Animation::_find_compressed_page(double p_time) const {
+	int32_t page_index = -1;
+	for (uint32_t i = 0; i < compression.pages.size(); i++) {
+		if (compression.pages[i].time_offset > p_time) {
+			break;
+		}
+		page_index = i;
+	}
+	return page_index;
+}
+
+// Dequantizes and interpolates 16-bit compressed components, several lanes at a time:
+// r_out = p_base + lerp(p_from, p_to, p_weight) / 65535 * p_scale.
+static void _dequantize_lerp_lanes(const float *p_from, const float *p_to, const float *p_weight, const float *p_base, const float *p_scale, float *r_out, uint32_t p_count) {
+	const float inv_range = 1.0f / 65535.0f;
+	uint32_t i = 0;
+#if defined(__SSE2__)
+	const __m128 inv_range4 = _mm_set1_ps(inv_range);
+	for (; i + 4 <= p_count; i += 4) {
+		const __m128 from = _mm_loadu_ps(p_from + i);
+		const __m128 to = _mm_loadu_ps(p_to + i);
+		const __m128 value = _mm_add_ps(from, _mm_mul_ps(_mm_sub_ps(to, from), _mm_loadu_ps(p_weight + i)));
+		_mm_storeu_ps(r_out + i, _mm_add_ps(_mm_loadu_ps(p_base + i), _mm_mul_ps(_mm_mul_ps(value, inv_range4), _mm_loadu_ps(p_scale + i))));
+	}
+#elif defined(__ARM_NEON)
+	const float32x4_t inv_range4 = vdupq_n_f32(inv_range);
+	for (; i + 4 <= p_count; i += 4) {
+		const float32x4_t from = vld1q_f32(p_from + i);
+		const float32x4_t to = vld1q_f32(p_to + i);
+		const float32x4_t value = vaddq_f32(from, vmulq_f32(vsubq_f32(to, from), vld1q_f32(p_weight + i)));
+		vst1q_f32(r_out + i, vaddq_f32(vld1q_f32(p_base + i), vmulq_f32(vmulq_f32(value, inv_range4), vld1q_f32(p_scale + i))));
+	}
+#endif
+	for (; i < p_count; i++) {
+		const float value = p_from[i] + (p_to[i] - p_from[i]) * p_weight[i];
+		r_out[i] = p_base[i] + value * inv_range * p_scale[i];
+	}
+}
+
+void Animation::sample_compressed_tracks(double p_time, CompressedTrackSamples &r_samples) const {
+	const uint32_t track_count = tracks.size();
+	r_samples.x.resize(track_count);
+	r_samples.y.resize(track_count);
+	r_samples.z.resize(track_count);
+	r_samples.w.resize(track_count);
+	r_samples.valid.resize(track_count);
+	r_samples.lane_track.clear();
+	r_samples.lane_from.clear();
+	r_samples.lane_to.clear();
+	r_samples.lane_weight.clear();
+	r_samples.lane_base.clear();
+	r_samples.lane_scale.clear();
+
+	// All tracks share the same page, so look it up only once.
+	const int32_t page_index = compression.enabled ? _find_compressed_page(CLAMP(p_time, 0, length)) : -1;
+
+	for (uint32_t i = 0; i < track_count; i++) {
+		const Track *t = tracks[i];
+		r_samples.valid[i] = 0;
+
+		int32_t compressed_track = -1;
+		switch (t->type) {
+			case TYPE_POSITION_3D: {
+				compressed_track = static_cast<const PositionTrack *>(t)->compressed_track;
+			} break;
+			case TYPE_ROTATION_3D: {
+				compressed_track = static_cast<const RotationTrack *>(t)->compressed_track;
+			} break;
+			case TYPE_SCALE_3D: {
+				compressed_track = static_cast<const ScaleTrack *>(t)->compressed_track;
+			} break;
+			case TYPE_BLEND_SHAPE: {
+				compressed_track = static_cast<const BlendShapeTrack *>(t)->compressed_track;
+			} break;
+			default: {
+				continue;
+			} break;
+		}
+
+		if (compressed_track < 0 || page_index < 0) {
+			// Track added after compression, sample it the regular way.
+			Error err = ERR_UNAVAILABLE;
+			switch (t->type) {
+				case TYPE_POSITION_3D:
+				case TYPE_SCALE_3D: {
+					Vector3 v;
+					err = t->type == TYPE_POSITION_3D ? try_position_track_interpolate(i, p_time, &v) : try_scale_track_interpolate(i, p_time, &v);
+					r_samples.x[i] = v.x;
+					r_samples.y[i] = v.y;
+					r_samples.z[i] = v.z;
+				} break;
+				case TYPE_ROTATION_3D: {
+					Quaternion q;
+					err = try_rotation_track_interpolate(i, p_time, &q);
+					r_samples.x[i] = q.x;
+					r_samples.y[i] = q.y;
+					r_samples.z[i] = q.z;
+					r_samples.w[i] = q.w;
+				} break;
+				default: {
+					float f = 0;
+					err = try_blend_shape_track_interpolate(i, p_time, &f);
+					r_samples.x[i] = f;
+				} break;
+			}
+			r_samples.valid[i] = err == OK;
+			continue;
+		}
+
+		Vector3i current;
+		Vector3i next;
+		double time_current;
+		double time_next;
+		bool fetched;
+		if (t->type == TYPE_BLEND_SHAPE) {
+			fetched = _fetch_compressed<1>(compressed_track, p_time, current, time_current, next, time_next, nullptr, page_index);
+		} else {
+			fetched = _fetch_compressed<3>(compressed_track, p_time, current, time_current, next, time_next, nullptr, page_index);
+		}
+		if (!fetched) {
+			continue;
+		}
+
+		// Same weighting as the single track interpolation functions.
+		float c;
+		if (time_current >= p_time || time_current == time_next) {
+			c = 0.0;
+		} else if (p_time >= time_next) {
+			c = 1.0;
+		} else {
+			c = (p_time - time_current) / (time_next - time_current);
+		}
+		r_samples.valid[i] = 1;
+
+		if (t->type == TYPE_ROTATION_3D) {
+			// Rotations need a slerp, which does not vectorize well; do them right away.
+			Quaternion q;
+			if (c == 0.0f) {
+				q = _uncompress_quaternion(current);
+			} else if (c == 1.0f) {
+				q = _uncompress_quaternion(next);
+			} else {
+				q = _uncompress_quaternion(current).slerp(_uncompress_quaternion(next), c);
+			}
+			r_samples.x[i] = q.x;
+			r_samples.y[i] = q.y;
+			r_samples.z[i] = q.z;
+			r_samples.w[i] = q.w;
+			continue;
+		}
+
+		// Everything else is a linear remap of the 16-bit values, queue one lane per component.
+		if (t->type == TYPE_BLEND_SHAPE) {
+			r_samples.lane_track.push_back(i * 3);
+			r_samples.lane_from.push_back(current.x);
+			r_samples.lane_to.push_back(next.x);
+			r_samples.lane_weight.push_back(c);
+			r_samples.lane_base.push_back(-float(Compression::BLEND_SHAPE_RANGE));
+			r_samples.lane_scale.push_back(2.0f * float(Compression::BLEND_SHAPE_RANGE));
+		} else {
+			const AABB &bounds = compression.bounds[compressed_track];
+			for (uint32_t j = 0; j < 3; j++) {
+				r_samples.lane_track.push_back(i * 3 + j);
+				r_samples.lane_from.push_back(current[j]);
+				r_samples.lane_to.push_back(next[j]);
+				r_samples.lane_weight.push_back(c);
+				r_samples.lane_base.push_back(bounds.position[j]);
+				r_samples.lane_scale.push_back(bounds.size[j]);
+			}
+		}
+	}
+
+	const uint32_t lane_count = r_samples.lane_track.size();
+	r_samples.lane_out.resize(lane_count);
+	_dequantize_lerp_lanes(r_samples.lane_from.ptr(), r_samples.lane_to.ptr(), r_samples.lane_weight.ptr(), r_samples.lane_base.ptr(), r_samples.lane_scale.ptr(), r_samples.lane_out.ptr(), lane_count);
+
+	float *components[3] = { r_samples.x.ptr(), r_samples.y.ptr(), r_samples.z.ptr() };
+	for (uint32_t i = 0; i < lane_count; i++) {
+		const uint32_t lane_track = r_samples.lane_track[i];
+		components[lane_track % 3][lane_track / 3] = r_samples.lane_out[i];
+	}
+}
+
 bool Animation::_rotation_interpolate_compressed(uint32_t p_compressed_track, double p_time, Quaternion &r_ret) const {
 	Vector3i current;
 	Vector3i next;
@@ -5322,7 +5511,7 @@ bool Animation::_blend_shape_interpolate_compressed(uint32_t p_compressed_track,
 }
 
 template <uint32_t COMPONENTS>
-bool Animation::_fetch_compressed(uint32_t p_compressed_track, double p_time, Vector3i &r_current_value, double &r_current_time, Vector3i &r_next_value, double &r_next_time, uint32_t *key_index) const {
+bool Animation::_fetch_compressed(uint32_t p_compressed_track, double p_time, Vector3i &r_current_value, double &r_current_time, Vector3i &r_next_value, double &r_next_time, uint32_t *key_index, int32_t p_page_index) const {
 	ERR_FAIL_COND_V(!compression.enabled, false);
 	ERR_FAIL_UNSIGNED_INDEX_V(p_compressed_track, compression.bounds.size(), false);
 	p_time = CLAMP(p_time, 0, length);
@@ -5332,13 +5521,8 @@ bool Animation::_fetch_compressed(uint32_t p_compressed_track, double p_time, Ve
 
 	double frame_to_sec = 1.0 / double(compression.fps);
 
-	int32_t page_index = -1;
-	for (uint32_t i = 0; i < compression.pages.size(); i++) {
-		if (compression.pages[i].time_offset > p_time) {
-			break;
-		}
-		page_index = i;
-	}
+	// The page may be looked up by the caller when fetching several tracks at the same time.
+	int32_t page_index = p_page_index >= 0 ? p_page_index : _find_compressed_page(p_time);
 
 	ERR_FAIL_COND_V(page_index == -1, false); //should not happen
 
@@ -117,6 +117,46 @@ public:
 		virtual ~Track() {}
 	};
 
+	// Values of all position, rotation, scale and blend shape tracks sampled at once by sample_compressed_tracks().
+	// Results are stored per track index; the lane arrays are scratch space reused between calls.
+	struct CompressedTrackSamples {
+		LocalVector<float> x;
+		LocalVector<float> y;
+		LocalVector<float> z;
+		LocalVector<float> w;
+		LocalVector<uint8_t> valid;
+
+		LocalVector<uint32_t> lane_track;
+		LocalVector<float> lane_from;
+		LocalVector<float> lane_to;
+		LocalVector<float> lane_weight;
+		LocalVector<float> lane_base;
+		LocalVector<float> lane_scale;
+		LocalVector<float> lane_out;
+
+		Error get_vector3(int p_track, Vector3 *r_value) const {
+			if (unlikely((uint32_t)p_track >= valid.size() || !valid[p_track])) {
+				return ERR_UNAVAILABLE;
+			}
+			*r_value = Vector3(x[p_track], y[p_track], z[p_track]);
+			return OK;
+		}
+		Error get_quaternion(int p_track, Quaternion *r_value) const {
+			if (unlikely((uint32_t)p_track >= valid.size() || !valid[p_track])) {
+				return ERR_UNAVAILABLE;
+			}
+			*r_value = Quaternion(x[p_track], y[p_track], z[p_track], w[p_track]);
+			return OK;
+		}
+		Error get_float(int p_track, float *r_value) const {
+			if (unlikely((uint32_t)p_track >= valid.size() || !valid[p_track])) {
+				return ERR_UNAVAILABLE;
+			}
+			*r_value = x[p_track];
+			return OK;
+		}
+	};
+
 private:
 	struct Key {
 		real_t transition = 1.0;
@@ -362,7 +402,8 @@ private:
 	bool _pos_scale_interpolate_compressed(uint32_t p_compressed_track, double p_time, Vector3 &r_ret) const;
 	bool _blend_shape_interpolate_compressed(uint32_t p_compressed_track, double p_time, float &r_ret) const;
 	template <uint32_t COMPONENTS>
-	bool _fetch_compressed(uint32_t p_compressed_track, double p_time, Vector3i &r_current_value, double &r_current_time, Vector3i &r_next_value, double &r_next_time, uint32_t *key_index = nullptr) const;
+	bool _fetch_compressed(uint32_t p_compressed_track, double p_time, Vector3i &r_current_value, double &r_current_time, Vector3i &r_next_value, double &r_next_time, uint32_t *key_index = nullptr, int32_t p_page_index = -1) const;
+	int32_t _find_compressed_page(double p_time) const;
 	template <uint32_t COMPONENTS>
 	bool _fetch_compressed_by_index(uint32_t p_compressed_track, int p_index, Vector3i &r_value, double &r_time) const;
 	int _get_compressed_key_count(uint32_t p_compressed_track) const;
@@ -448,6 +489,8 @@ public:
 	double track_get_key_time(int p_track, int p_key_idx) const;
 	real_t track_get_key_transition(int p_track, int p_key_idx) const;
 	bool track_is_compressed(int p_track) const;
+	bool is_compressed() const { return compression.enabled; }
+	void sample_compressed_tracks(double p_time, CompressedTrackSamples &r_samples) const;
 
 	int position_track_insert_key(int p_track, double p_time, const Vector3 &p_position);
 	Error position_track_get_key(int p_track, int p_key, Vector3 *r_position) const;
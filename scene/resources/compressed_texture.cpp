@@ -328,18 +328,25 @@ Ref<Image> CompressedTexture2D::load_image_from_file(Ref<FileAccess> f, int p_si
 				continue;
 			}
 
-			Vector<uint8_t> pv;
-			pv.resize(size);
-			{
-				uint8_t *wr = pv.ptrw();
-				f->get_buffer(wr, size);
-			}
-
 			Ref<Image> img;
-			if (data_format == DATA_FORMAT_PNG && Image::png_unpacker) {
-				img = Image::png_unpacker(pv);
-			} else if (data_format == DATA_FORMAT_WEBP && Image::webp_unpacker) {
-				img = Image::webp_unpacker(pv);
+			const uint8_t *mapped_data = f->get_mapped_data();
+			if (mapped_data && data_format == DATA_FORMAT_PNG && Image::_png_mem_unpacker_func && f->get_position() + size <= f->get_length()) {
+				// Decode straight from the mapped file instead of copying it first.
+				img = Image::_png_mem_unpacker_func(mapped_data + f->get_position(), size);
+				f->seek(f->get_position() + size);
+			} else {
+				Vector<uint8_t> pv;
+				pv.resize(size);
+				{
+					uint8_t *wr = pv.ptrw();
+					f->get_buffer(wr, size);
+				}
+
+				if (data_format == DATA_FORMAT_PNG && Image::png_unpacker) {
+					img = Image::png_unpacker(pv);
+				} else if (data_format == DATA_FORMAT_WEBP && Image::webp_unpacker) {
+					img = Image::webp_unpacker(pv);
+				}
 			}
 
 			if (img.is_null() || img->is_empty()) {
@@ -435,13 +442,8 @@ Ref<Image> CompressedTexture2D::load_image_from_file(Ref<FileAccess> f, int p_si
 				continue; //oops, size limit enforced, go to next
 			}
 
-			Vector<uint8_t> data;
-			data.resize(size - ofs);
-
-			{
-				uint8_t *wr = data.ptrw();
-				f->get_buffer(wr, data.size());
-			}
+			// Shares the memory of mapped packs until the image is modified.
+			Vector<uint8_t> data = f->get_buffer_view(size - ofs);
 
 			Ref<Image> image = Image::create_from_data(tw, th, mipmaps - i ? true : false, format, data);
 
@@ -126,6 +126,78 @@ Ref<Resource> SceneState::get_remap_resource(const Ref<Resource> &p_resource, Ha
 	return remap_resource;
 }
 
+const SceneState::NodePlan *SceneState::_get_instantiation_plan() const {
+	if (instantiation_plan_built.is_set()) {
+		return instantiation_plan.ptr();
+	}
+
+	MutexLock lock(instantiation_plan_mutex);
+	if (instantiation_plan_built.is_set()) {
+		return instantiation_plan.ptr();
+	}
+
+	instantiation_plan.clear();
+	instantiation_plan.resize(nodes.size());
+
+	for (int i = 0; i < nodes.size(); i++) {
+		const NodeData &n = nodes[i];
+
+		// Only nodes created from their class are planned, others come from instances or inheritance.
+		if (n.instance >= 0 || n.type == TYPE_INSTANTIATED || (i == 0 && base_scene_idx >= 0) || n.type < 0 || n.type >= names.size()) {
+			continue;
+		}
+
+		NodePlan &node_plan = instantiation_plan[i];
+		const StringName &type = names[n.type];
+		node_plan.creator = ClassDB::get_native_creation_func(type);
+		if (!node_plan.creator) {
+			continue;
+		}
+
+		node_plan.properties.resize(n.properties.size());
+		for (int j = 0; j < n.properties.size(); j++) {
+			const NodeData::Property &prop = n.properties[j];
+			if ((prop.name & FLAG_PATH_PROPERTY_IS_NODE) || prop.name < 0 || prop.name >= names.size() || prop.value < 0 || prop.value >= variants.size()) {
+				continue;
+			}
+
+			const StringName &name = names[prop.name];
+			const Variant::Type value_type = variants[prop.value].get_type();
+			if (name == CoreStringName(script) || value_type == Variant::OBJECT || value_type == Variant::ARRAY || value_type == Variant::DICTIONARY) {
+				continue; // Values processed before being set.
+			}
+
+			// Without a script, Object::set() ends up calling this setter.
+			const ClassDB::PropertySetGet *psg = ClassDB::get_property_setget(type, name);
+			if (!psg || !psg->_setptr || psg->_setptr->is_vararg()) {
+				continue;
+			}
+
+			PropertyPlan &property_plan = node_plan.properties[j];
+			property_plan.setter = psg->_setptr;
+			int arg_count = 1;
+			if (psg->index >= 0) {
+				property_plan.index = psg->index;
+				arg_count = 2;
+			}
+
+			if (psg->_setptr->get_argument_count() == arg_count && (arg_count == 1 || psg->_setptr->get_argument_type(0) == Variant::INT)) {
+				const Variant::Type arg_type = psg->_setptr->get_argument_type(arg_count - 1);
+				property_plan.validated = arg_type == value_type || arg_type == Variant::NIL;
+			}
+		}
+	}
+
+	instantiation_plan_built.set();
+	return instantiation_plan.ptr();
+}
+
+void SceneState::_clear_instantiation_plan() {
+	MutexLock lock(instantiation_plan_mutex);
+	instantiation_plan_built.clear();
+	instantiation_plan.clear();
+}
+
 Node *SceneState::instantiate(GenEditState p_edit_state) const {
 	// Nodes where instantiation failed (because something is missing.)
 	List<Node *> stray_instances;
@@ -167,8 +239,15 @@ Node *SceneState::instantiate(GenEditState p_edit_state) const {
 
 	LocalVector<DeferredNodePathProperties> deferred_node_paths;
 
+	// The plan skips steps only needed by the editor.
+	const NodePlan *plan = nullptr;
+	if (p_edit_state == GEN_EDIT_STATE_DISABLED && !Engine::get_singleton()->is_editor_hint()) {
+		plan = _get_instantiation_plan();
+	}
+
 	for (int i = 0; i < nc; i++) {
 		const NodeData &n = nd[i];
+		const NodePlan *node_plan = nullptr;
 
 		Node *parent = nullptr;
 		String old_parent_path;
@@ -259,11 +338,18 @@ Node *SceneState::instantiate(GenEditState p_edit_state) const {
 			}
 		} else {
 			// Node belongs to this scene and must be created.
-			Object *obj = ClassDB::instantiate(snames[n.type]);
+			Object *obj = nullptr;
+			if (plan && plan[i].creator) {
+				node_plan = &plan[i];
+				obj = node_plan->creator(true);
+			} else {
+				obj = ClassDB::instantiate(snames[n.type]);
+			}
 
 			node = Object::cast_to<Node>(obj);
 
 			if (!node) {
+				node_plan = nullptr;
 				if (obj) {
 					memdelete(obj);
 					obj = nullptr;
@@ -313,6 +399,21 @@ Node *SceneState::instantiate(GenEditState p_edit_state) const {
 				for (int j = 0; j < nprop_count; j++) {
 					bool valid;
 
+					if (node_plan && node_plan->properties[j].setter && !node->get_script_instance()) {
+						const PropertyPlan &property_plan = node_plan->properties[j];
+						const Variant *args[2] = { &property_plan.index, &props[nprops[j].value] };
+						const bool indexed = property_plan.index.get_type() != Variant::NIL;
+						const Variant **setter_args = indexed ? args : &args[1];
+						if (property_plan.validated) {
+							Variant ret;
+							property_plan.setter->validated_call(node, setter_args, &ret);
+						} else {
+							Callable::CallError ce;
+							property_plan.setter->call(node, setter_args, indexed ? 2 : 1, ce);
+						}
+						continue;
+					}
+
 					ERR_FAIL_INDEX_V(nprops[j].value, prop_count, nullptr);
 
 					if (nprops[j].name & FLAG_PATH_PROPERTY_IS_NODE) {
@@ -1316,6 +1417,7 @@ String SceneState::get_path() const {
 }
 
 void SceneState::clear() {
+	_clear_instantiation_plan();
 	names.clear();
 	variants.clear();
 	nodes.clear();
@@ -1514,6 +1616,8 @@ void SceneState::set_bundled_scene(const Dictionary &p_dictionary) {
 
 	ERR_FAIL_COND_MSG(version > PACKED_SCENE_VERSION, "Save format version too new.");
 
+	_clear_instantiation_plan();
+
 	const int node_count = p_dictionary["node_count"];
 	const Vector<int> snodes = p_dictionary["nodes"];
 	ERR_FAIL_COND(snodes.size() < node_count);
@@ -1975,11 +2079,13 @@ Ref<Resource> SceneState::get_sub_resource(const String &p_path) {
 //add
 
 int SceneState::add_name(const StringName &p_name) {
+	_clear_instantiation_plan();
 	names.push_back(p_name);
 	return names.size() - 1;
 }
 
 int SceneState::add_value(const Variant &p_value) {
+	_clear_instantiation_plan();
 	variants.push_back(p_value);
 	return variants.size() - 1;
 }
@@ -1990,6 +2096,7 @@ int SceneState::add_node_path(const NodePath &p_path) {
 }
 
 int SceneState::add_node(int p_parent, int p_owner, int p_type, int p_name, int p_instance, int p_index) {
+	_clear_instantiation_plan();
 	NodeData nd;
 	nd.parent = p_parent;
 	nd.owner = p_owner;
@@ -2008,6 +2115,8 @@ void SceneState::add_node_property(int p_node, int p_name, int p_value, bool p_d
 	ERR_FAIL_INDEX(p_name, names.size());
 	ERR_FAIL_INDEX(p_value, variants.size());
 
+	_clear_instantiation_plan();
+
 	NodeData::Property prop;
 	prop.name = p_name;
 	if (p_deferred_node_path) {
@@ -2025,6 +2134,7 @@ void SceneState::add_node_group(int p_node, int p_group) {
 
 void SceneState::set_base_scene(int p_idx) {
 	ERR_FAIL_INDEX(p_idx, variants.size());
+	_clear_instantiation_plan();
 	base_scene_idx = p_idx;
 }
 
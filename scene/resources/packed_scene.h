@@ -90,6 +90,26 @@ class SceneState : public RefCounted {
 
 	Vector<ConnectionData> connections;
 
+	// Data resolved once to speed up instantiating the scene at runtime: class creators and native
+	// setters for properties whose values need no processing. Unresolved entries use the regular path.
+	struct PropertyPlan {
+		MethodBind *setter = nullptr;
+		Variant index; // Only set for indexed properties.
+		bool validated = false; // Value types match the setter arguments, so it can skip checks.
+	};
+
+	struct NodePlan {
+		ClassDB::CreationFunc creator = nullptr;
+		LocalVector<PropertyPlan> properties;
+	};
+
+	mutable BinaryMutex instantiation_plan_mutex;
+	mutable SafeFlag instantiation_plan_built;
+	mutable LocalVector<NodePlan> instantiation_plan;
+
+	const NodePlan *_get_instantiation_plan() const;
+	void _clear_instantiation_plan();
+
 	Error _parse_node(Node *p_owner, Node *p_node, int p_parent_idx, HashMap<StringName, int> &name_map, HashMap<Variant, int, VariantHasher, VariantComparator> &variant_map, HashMap<Node *, int> &node_map, HashMap<Node *, int> &nodepath_map);
 	Error _parse_connections(Node *p_owner, Node *p_node, HashMap<StringName, int> &name_map, HashMap<Variant, int, VariantHasher, VariantComparator> &variant_map, HashMap<Node *, int> &node_map, HashMap<Node *, int> &nodepath_map);
 
@@ -36,6 +36,9 @@
 #include "core/io/dir_access.h"
 #include "core/io/missing_resource.h"
 #include "core/object/script_language.h"
+#include "core/version.h"
+
+#define BINARY_CACHE_DIR "user://text_resource_cache"
 
 void ResourceLoaderText::_printerr() {
 	ERR_PRINT(vformat("%s:%d - Parse Error: %s.", res_path, lines, error_text));
@@ -1389,8 +1392,24 @@ Ref<Resource> ResourceFormatLoaderText::load(const String &p_path, const String
 
 	ERR_FAIL_COND_V_MSG(err != OK, Ref<Resource>(), "Cannot open file '" + p_path + "'.");
 
-	ResourceLoaderText loader;
 	String path = !p_original_path.is_empty() ? p_original_path : p_path;
+
+	// Cached translations are keyed by path, contents and engine build, so any change invalidates them.
+	String cache_path;
+	String cache_key;
+	if (binary_cache_loader.is_valid()) {
+		const String local_path = ProjectSettings::get_singleton()->localize_path(path);
+		cache_path = String(BINARY_CACHE_DIR).path_join(local_path.md5_text());
+		cache_key = (String(REDOT_VERSION_FULL_BUILD) + "|" + local_path + "|" + FileAccess::get_md5(p_path)).md5_text();
+		if (FileAccess::exists(cache_path + ".key") && FileAccess::get_file_as_string(cache_path + ".key") == cache_key) {
+			Ref<Resource> res = binary_cache_loader->load(cache_path + ".res", path, r_error, p_use_sub_threads, r_progress, p_cache_mode);
+			if (res.is_valid()) {
+				return res;
+			}
+		}
+	}
+
+	ResourceLoaderText loader;
 	switch (p_cache_mode) {
 		case CACHE_MODE_IGNORE:
 		case CACHE_MODE_REUSE:
@@ -1417,12 +1436,44 @@ Ref<Resource> ResourceFormatLoaderText::load(const String &p_path, const String
 		*r_error = err;
 	}
 	if (err == OK) {
+		if (!cache_key.is_empty()) {
+			_save_binary_cache(loader.get_resource(), cache_path, cache_key);
+		}
 		return loader.get_resource();
 	} else {
 		return Ref<Resource>();
 	}
 }
 
+void ResourceFormatLoaderText::_save_binary_cache(const Ref<Resource> &p_resource, const String &p_cache_path, const String &p_key) const {
+	if (!DirAccess::exists(BINARY_CACHE_DIR) && DirAccess::make_dir_recursive_absolute(BINARY_CACHE_DIR) != OK) {
+		return;
+	}
+
+	// Written through temporary files, so loads running at the same time never see a partial translation.
+	FileAccess::set_thread_backup_save(true);
+	Error err = ResourceFormatSaverBinary::singleton->save(p_resource, p_cache_path + ".res");
+	if (err == OK) {
+		Ref<FileAccess> f = FileAccess::open(p_cache_path + ".key", FileAccess::WRITE, &err);
+		if (f.is_valid()) {
+			f->store_string(p_key);
+		}
+	}
+	FileAccess::set_thread_backup_save(false);
+
+	if (err != OK) {
+		print_verbose(vformat("Could not cache a binary translation of text resource '%s'.", p_resource->get_path()));
+	}
+}
+
+void ResourceFormatLoaderText::set_binary_cache_enabled(bool p_enabled) {
+	if (p_enabled && binary_cache_loader.is_null()) {
+		binary_cache_loader.instantiate();
+	} else if (!p_enabled) {
+		binary_cache_loader.unref();
+	}
+}
+
 void ResourceFormatLoaderText::get_recognized_extensions_for_type(const String &p_type, List<String> *p_extensions) const {
 	if (p_type.is_empty()) {
 		get_recognized_extensions(p_extensions);
@@ -1863,7 +1914,9 @@ Error ResourceFormatSaverTextInstance::save(const String &p_path, const Ref<Reso
 		}
 	}
 
+	int saved_count = 0;
 	for (List<Ref<Resource>>::Element *E = saved_resources.front(); E; E = E->next()) {
+		ResourceSaver::set_thread_save_progress(saved_count++ / float(saved_resources.size()));
 		Ref<Resource> res = E->get();
 		ERR_CONTINUE(!resource_set.has(res));
 		bool main = (E->next() == nullptr);
@@ -33,6 +33,7 @@
 #pragma once
 
 #include "core/io/file_access.h"
+#include "core/io/resource_format_binary.h"
 #include "core/io/resource_loader.h"
 #include "core/io/resource_saver.h"
 #include "core/variant/variant_parser.h"
@@ -145,8 +146,15 @@ public:
 };
 
 class ResourceFormatLoaderText : public ResourceFormatLoader {
+	// Binary translations of loaded text resources, so the next loads skip parsing.
+	Ref<ResourceFormatLoaderBinary> binary_cache_loader;
+
+	void _save_binary_cache(const Ref<Resource> &p_resource, const String &p_cache_path, const String &p_key) const;
+
 public:
 	static ResourceFormatLoaderText *singleton;
+	void set_binary_cache_enabled(bool p_enabled);
+	bool is_binary_cache_enabled() const { return binary_cache_loader.is_valid(); }
 	virtual Ref<Resource> load(const String &p_path, const String &p_original_path = "", Error *r_error = nullptr, bool p_use_sub_threads = false, float *r_progress = nullptr, CacheMode p_cache_mode = CACHE_MODE_REUSE) override;
 	virtual void get_recognized_extensions_for_type(const String &p_type, List<String> *p_extensions) const override;
 	virtual void get_recognized_extensions(List<String> *p_extensions) const override;
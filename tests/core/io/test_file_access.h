@@ -33,6 +33,7 @@
 #pragma once
 
 #include "core/io/file_access.h"
+#include "core/object/worker_thread_pool.h"
 #include "tests/test_macros.h"
 #include "tests/test_utils.h"
 
@@ -222,4 +223,158 @@ TEST_CASE("[FileAccess] Get/Store floating point half precision values") {
 	}
 }
 
+TEST_CASE("[FileAccess] Read memory-mapped file") {
+	const String file_path = TestUtils::get_data_path("testdata.csv");
+	Error err = OK;
+	Ref<FileAccess> mapped = FileAccess::open_mapped(file_path, &err);
+	if (err == ERR_UNAVAILABLE) {
+		return; // Not supported on this platform.
+	}
+	REQUIRE(mapped.is_valid());
+
+	const Vector<uint8_t> reference = FileAccess::get_file_as_bytes(file_path);
+	REQUIRE(mapped->get_length() == uint64_t(reference.size()));
+	REQUIRE(mapped->get_mapped_data() != nullptr);
+	CHECK(memcmp(mapped->get_mapped_data(), reference.ptr(), reference.size()) == 0);
+
+	mapped->seek(4);
+	CHECK(mapped->get_8() == reference[4]);
+	const Vector<uint8_t> tail = mapped->get_buffer(reference.size());
+	CHECK(tail.size() == reference.size() - 5);
+	CHECK(mapped->eof_reached());
+
+	mapped->close();
+	CHECK_FALSE(mapped->is_open());
+}
+
+TEST_CASE("[FileAccess] Share memory-mapped buffers until written") {
+	const String file_path = TestUtils::get_temp_path("file_access_mapped_view.bin");
+	Vector<uint8_t> reference;
+	reference.resize(256 * 1024);
+	for (int i = 0; i < reference.size(); i++) {
+		reference.write[i] = i * 7;
+	}
+	{
+		Ref<FileAccess> f = FileAccess::open(file_path, FileAccess::WRITE);
+		REQUIRE(f.is_valid());
+		f->store_buffer(reference);
+	}
+
+	Error err = OK;
+	Ref<FileAccess> mapped = FileAccess::open_mapped(file_path, &err);
+	if (err == ERR_UNAVAILABLE) {
+		return; // Not supported on this platform.
+	}
+	REQUIRE(mapped.is_valid());
+
+	// Small reads are copied.
+	Vector<uint8_t> small = mapped->get_buffer_view(16);
+	CHECK(small.size() == 16);
+	CHECK_FALSE(small.is_external());
+
+	const int64_t offsets[] = { 16, 4096, 4104 };
+	for (const int64_t offset : offsets) {
+		mapped->seek(offset);
+		Vector<uint8_t> view = mapped->get_buffer_view(128 * 1024);
+		CHECK(mapped->get_position() == uint64_t(offset + 128 * 1024));
+		REQUIRE(view.size() == 128 * 1024);
+		CHECK(view.is_external());
+		CHECK(memcmp(view.ptr(), reference.ptr() + offset, view.size()) == 0);
+
+		Vector<uint8_t> shared = view;
+		CHECK(shared.ptr() == view.ptr());
+
+		// Writing copies the data, leaving the mapping untouched.
+		shared.write[0] = ~shared[0];
+		CHECK_FALSE(shared.is_external());
+		CHECK(shared[0] != view[0]);
+		CHECK(view[0] == reference[offset]);
+		CHECK(mapped->get_mapped_data()[offset] == reference[offset]);
+	}
+
+	mapped->close();
+	DirAccess::remove_absolute(file_path);
+}
+
+TEST_CASE("[FileAccess] Compressed file spanning many blocks") {
+	const String file_path = TestUtils::get_temp_path("file_access_compressed_blocks.bin");
+	// Large enough for blocks to be compressed in parallel and read ahead.
+	Vector<uint8_t> reference;
+	reference.resize(1024 * 1024 + 123);
+	for (int i = 0; i < reference.size(); i++) {
+		reference.write[i] = (i * 31) ^ (i >> 9);
+	}
+
+	const FileAccess::CompressionMode modes[] = { FileAccess::COMPRESSION_FASTLZ, FileAccess::COMPRESSION_DEFLATE, FileAccess::COMPRESSION_ZSTD };
+	for (const FileAccess::CompressionMode mode : modes) {
+		{
+			Ref<FileAccess> f = FileAccess::open_compressed(file_path, FileAccess::WRITE, mode);
+			REQUIRE(f.is_valid());
+			f->store_buffer(reference);
+		}
+
+		Ref<FileAccess> f = FileAccess::open_compressed(file_path, FileAccess::READ, mode);
+		REQUIRE(f.is_valid());
+		CHECK(f->get_length() == uint64_t(reference.size()));
+
+		// Read sequentially in chunks that straddle block boundaries.
+		Vector<uint8_t> data;
+		while (!f->eof_reached()) {
+			const Vector<uint8_t> chunk = f->get_buffer(10000);
+			if (chunk.is_empty()) {
+				break;
+			}
+			data.append_array(chunk);
+		}
+		CHECK(data == reference);
+
+		// Seeking back and forth has to give the same bytes.
+		const uint64_t positions[] = { 0, 700000, 4096, 1000000, 300000, 300001 + 256 * 1024 };
+		for (const uint64_t position : positions) {
+			f->seek(position);
+			CHECK(f->get_position() == position);
+			CHECK(f->get_8() == reference[position]);
+			CHECK(f->get_buffer(5000) == reference.slice(position + 1, position + 5001));
+		}
+		f->close();
+	}
+
+	DirAccess::remove_absolute(file_path);
+}
+
+TEST_CASE("[FileAccess] Close compressed file from a worker thread") {
+	struct WriteFromTask {
+		String path;
+		Vector<uint8_t> data;
+
+		static void write(void *p_userdata) {
+			WriteFromTask *write_from_task = (WriteFromTask *)p_userdata;
+			Ref<FileAccess> f = FileAccess::open_compressed(write_from_task->path, FileAccess::WRITE);
+			if (f.is_valid()) {
+				f->store_buffer(write_from_task->data);
+				f->close();
+			}
+		}
+	};
+
+	WriteFromTask write_from_task;
+	write_from_task.path = TestUtils::get_temp_path("file_access_compressed_task.bin");
+	// Several blocks, which would otherwise be compressed in a group waited on from the task.
+	write_from_task.data.resize(512 * 1024);
+	for (int i = 0; i < write_from_task.data.size(); i++) {
+		write_from_task.data.write[i] = (i * 17) ^ (i >> 11);
+	}
+
+	const WorkerThreadPool::TaskID task_id = WorkerThreadPool::get_singleton()->add_native_task(&WriteFromTask::write, &write_from_task, false, "Write compressed file");
+	WorkerThreadPool::get_singleton()->wait_for_task_completion(task_id);
+
+	Ref<FileAccess> f = FileAccess::open_compressed(write_from_task.path, FileAccess::READ);
+	REQUIRE(f.is_valid());
+	CHECK(f->get_length() == uint64_t(write_from_task.data.size()));
+	CHECK(f->get_buffer(write_from_task.data.size()) == write_from_task.data);
+	f->close();
+
+	DirAccess::remove_absolute(write_from_task.path);
+}
+
 } // namespace TestFileAccess
@@ -311,6 +311,90 @@ TEST_CASE("[JSON] Parsing escape sequences") {
 	}
 }
 
+TEST_CASE("[JSON] Parsing UTF-8 buffers") {
+	const String text = String::utf8(R"({"name": "Redot Engine ★ with a name long enough to span several words", "escaped": "a\"b\\cé", "multi
+line": [1, -2.5, 3e2, true, null], "empty": []})");
+
+	JSON from_string;
+	REQUIRE(from_string.parse(text) == OK);
+	JSON from_buffer;
+	REQUIRE(from_buffer.parse_buffer(text.to_utf8_buffer()) == OK);
+	CHECK_MESSAGE(
+			from_buffer.get_data() == from_string.get_data(),
+			"Parsing a UTF-8 buffer should give the same result as parsing the decoded string.");
+
+	ERR_PRINT_OFF;
+	CHECK_MESSAGE(
+			from_buffer.parse_buffer(String(R"({"unterminated": "abc)").to_utf8_buffer()) == ERR_PARSE_ERROR,
+			"Parsing an unterminated string from a buffer should fail.");
+	ERR_PRINT_ON;
+}
+
+TEST_CASE("[JSON] Parsing typed arrays") {
+	JSON json;
+	REQUIRE(json.parse_buffer(String(R"({"ints": [1, -2, 9007199254740993], "floats": [1, 2.5, -3e2], "mixed": [1, "two"], "empty": []})").to_utf8_buffer(), true) == OK);
+	const Dictionary dictionary = json.get_data();
+
+	REQUIRE(dictionary["ints"].get_type() == Variant::PACKED_INT64_ARRAY);
+	const PackedInt64Array ints = dictionary["ints"];
+	CHECK(ints.size() == 3);
+	CHECK(ints[1] == -2);
+	CHECK_MESSAGE(
+			ints[2] == 9007199254740993,
+			"Integers should be parsed exactly, without going through a double.");
+
+	REQUIRE(dictionary["floats"].get_type() == Variant::PACKED_FLOAT64_ARRAY);
+	const PackedFloat64Array floats = dictionary["floats"];
+	CHECK(floats.size() == 3);
+	CHECK(floats[0] == doctest::Approx(1.0));
+	CHECK(floats[2] == doctest::Approx(-300.0));
+
+	REQUIRE(dictionary["mixed"].get_type() == Variant::ARRAY);
+	const Array mixed = dictionary["mixed"];
+	CHECK(mixed[0] == Variant(1.0));
+	CHECK(mixed[1] == "two");
+
+	CHECK(dictionary["empty"].get_type() == Variant::ARRAY);
+
+	REQUIRE(json.parse_buffer(String("[1, 2]").to_utf8_buffer()) == OK);
+	CHECK_MESSAGE(
+			json.get_data().get_type() == Variant::ARRAY,
+			"Arrays should stay untyped unless requested.");
+
+	REQUIRE(json.parse_buffer(String("[1, 99999999999999999999]").to_utf8_buffer(), true) == OK);
+	CHECK_MESSAGE(
+			json.get_data().get_type() == Variant::PACKED_FLOAT64_ARRAY,
+			"Integers that don't fit in 64 bits should be kept as floats.");
+	const PackedFloat64Array large = json.get_data();
+	CHECK(large[1] == doctest::Approx(1e20));
+}
+
+TEST_CASE("[JSON] Parsing malformed numbers") {
+	ERR_PRINT_OFF;
+	for (const String &text : { "[1-2]", "[1.2.3]", "[--5]", "-", "[1, 2-]" }) {
+		JSON from_string;
+		CHECK_MESSAGE(
+				from_string.parse(text) == ERR_PARSE_ERROR,
+				vformat("Parsing \"%s\" should fail.", text));
+		JSON from_buffer;
+		CHECK_MESSAGE(
+				from_buffer.parse_buffer(text.to_utf8_buffer()) == ERR_PARSE_ERROR,
+				vformat("Parsing \"%s\" from a buffer should fail.", text));
+		CHECK_MESSAGE(
+				from_buffer.parse_buffer(text.to_utf8_buffer(), true) == ERR_PARSE_ERROR,
+				vformat("Parsing \"%s\" from a buffer with typed arrays should fail.", text));
+	}
+	ERR_PRINT_ON;
+}
+
+TEST_CASE("[JSON] Stringify packed arrays") {
+	CHECK(JSON::stringify(PackedInt64Array({ 1, -2, 3 })) == "[1,-2,3]");
+	CHECK(JSON::stringify(PackedInt32Array()) == "[]");
+	CHECK(JSON::stringify(PackedFloat64Array({ 0.5, 0.0 }), "\t") == "[\n\t0.5,\n\t0.0\n]");
+	CHECK(JSON::stringify(PackedFloat32Array({ 0.25 })) == JSON::stringify(Array({ 0.25 })));
+	CHECK(JSON::stringify(PackedStringArray({ "a", "b\n" })) == "[\"a\",\"b\\n\"]");
+}
+
 TEST_CASE("[JSON] Serialization") {
 	JSON json;
 
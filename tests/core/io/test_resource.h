@@ -32,11 +32,16 @@
 
 #pragma once
 
+#include "core/config/project_settings.h"
+#include "core/io/config_file.h"
+#include "core/io/dir_access.h"
 #include "core/io/resource.h"
 #include "core/io/resource_loader.h"
 #include "core/io/resource_saver.h"
+#include "core/object/message_queue.h"
 #include "core/os/os.h"
 #include "scene/main/node.h"
+#include "scene/resources/resource_format_text.h"
 
 #include "thirdparty/doctest/doctest.h"
 
@@ -635,4 +640,203 @@ TEST_CASE("[Resource] Breaking circular references on save") {
 	// Break circular reference to avoid memory leak
 	resource_c->remove_meta("next");
 }
+
+TEST_CASE("[Resource] Loading binary sub-resources on multiple threads") {
+	// Enough sub-resources to parse them in parallel, each referencing the previous one.
+	Ref<Resource> resource = memnew(Resource);
+	Ref<Resource> previous;
+	for (int i = 0; i < 32; i++) {
+		Ref<Resource> child_resource = memnew(Resource);
+		child_resource->set_name(vformat("Child %d", i));
+		child_resource->set_meta("previous", previous);
+		PackedInt32Array values;
+		values.resize(1024);
+		values.fill(i);
+		child_resource->set_meta("values", values);
+		previous = child_resource;
+	}
+	resource->set_meta("last", previous);
+
+	const String save_path_binary = TestUtils::get_temp_path("resource_sub_threads.res");
+	REQUIRE(ResourceSaver::save(resource, save_path_binary) == OK);
+
+	REQUIRE(ResourceLoader::load_threaded_request(save_path_binary, "", true, ResourceFormatLoader::CACHE_MODE_IGNORE) == OK);
+	const Ref<Resource> loaded_resource = ResourceLoader::load_threaded_get(save_path_binary);
+	REQUIRE(loaded_resource.is_valid());
+
+	Ref<Resource> loaded_child_resource = loaded_resource->get_meta("last");
+	for (int i = 31; i >= 0; i--) {
+		REQUIRE(loaded_child_resource.is_valid());
+		CHECK(loaded_child_resource->get_name() == vformat("Child %d", i));
+		const PackedInt32Array values = loaded_child_resource->get_meta("values");
+		CHECK(values.size() == 1024);
+		CHECK(values[1023] == i);
+		loaded_child_resource = loaded_child_resource->get_meta("previous", Ref<Resource>());
+	}
+	CHECK(loaded_child_resource.is_null());
+
+	// Sub-thread loads run as low-priority tasks, so parsing in parallel must not wait on low-priority slots.
+	struct LoadFromTask {
+		String path;
+		Ref<Resource> loaded_resource;
+
+		static void load(void *p_userdata) {
+			LoadFromTask *load_from_task = (LoadFromTask *)p_userdata;
+			if (ResourceLoader::load_threaded_request(load_from_task->path, "", true, ResourceFormatLoader::CACHE_MODE_IGNORE) == OK) {
+				load_from_task->loaded_resource = ResourceLoader::load_threaded_get(load_from_task->path);
+			}
+		}
+	};
+	LoadFromTask load_from_task;
+	load_from_task.path = save_path_binary;
+	const WorkerThreadPool::TaskID task_id = WorkerThreadPool::get_singleton()->add_native_task(&LoadFromTask::load, &load_from_task, false, "Load from a low-priority task");
+	WorkerThreadPool::get_singleton()->wait_for_task_completion(task_id);
+	REQUIRE(load_from_task.loaded_resource.is_valid());
+	const Ref<Resource> loaded_last_resource = load_from_task.loaded_resource->get_meta("last");
+	REQUIRE(loaded_last_resource.is_valid());
+	CHECK(loaded_last_resource->get_name() == "Child 31");
+}
+
+TEST_CASE("[Resource] Saving on a worker thread") {
+	Ref<Resource> resource = memnew(Resource);
+	resource->set_name("Before saving");
+	Ref<Resource> child_resource = memnew(Resource);
+	child_resource->set_name("Child before saving");
+	resource->set_meta("child", child_resource);
+
+	const String save_path_binary = TestUtils::get_temp_path("resource_threaded.res");
+	const String save_path_text = TestUtils::get_temp_path("resource_threaded.tres");
+	REQUIRE(ResourceSaver::save_threaded(resource, save_path_binary) == OK);
+	REQUIRE(ResourceSaver::save_threaded(resource, save_path_text) == OK);
+
+	// A copy is saved, so changes made meanwhile aren't.
+	resource->set_name("After saving");
+	child_resource->set_name("Child after saving");
+
+	CHECK(ResourceSaver::save_threaded_get_status(save_path_binary) != ResourceSaver::THREAD_SAVE_INVALID_RESOURCE);
+	CHECK(ResourceSaver::save_threaded_wait(save_path_binary) == OK);
+	CHECK(ResourceSaver::save_threaded_wait(save_path_text) == OK);
+	CHECK(ResourceSaver::save_threaded_get_status(save_path_binary) == ResourceSaver::THREAD_SAVE_INVALID_RESOURCE);
+
+	for (const String &save_path : { save_path_binary, save_path_text }) {
+		const Ref<Resource> loaded_resource = ResourceLoader::load(save_path, "", ResourceFormatLoader::CACHE_MODE_IGNORE);
+		REQUIRE(loaded_resource.is_valid());
+		CHECK(loaded_resource->get_name() == "Before saving");
+		const Ref<Resource> loaded_child_resource = loaded_resource->get_meta("child");
+		REQUIRE(loaded_child_resource.is_valid());
+		CHECK(loaded_child_resource->get_name() == "Child before saving");
+	}
+}
+
+TEST_CASE("[Resource] Saving on a worker thread keeps sub-resource IDs") {
+	Ref<Resource> resource = memnew(Resource);
+	Ref<Resource> child_resource = memnew(Resource);
+	child_resource->set_scene_unique_id("child_id");
+	resource->set_meta("child", child_resource);
+	Ref<Resource> new_child_resource = memnew(Resource);
+	resource->set_meta("new_child", new_child_resource);
+
+	const String save_path = TestUtils::get_temp_path("resource_threaded_ids.tres");
+	REQUIRE(ResourceSaver::save_threaded(resource, save_path) == OK);
+	CHECK(ResourceSaver::save_threaded_wait(save_path) == OK);
+	MessageQueue::get_singleton()->flush();
+
+	// The ID given to the new sub-resource while saving is passed to the original.
+	CHECK(child_resource->get_scene_unique_id() == "child_id");
+	CHECK_FALSE(new_child_resource->get_scene_unique_id().is_empty());
+
+	const Ref<Resource> loaded_resource = ResourceLoader::load(save_path, "", ResourceFormatLoader::CACHE_MODE_IGNORE);
+	REQUIRE(loaded_resource.is_valid());
+	const Ref<Resource> loaded_child_resource = loaded_resource->get_meta("child");
+	REQUIRE(loaded_child_resource.is_valid());
+	CHECK(loaded_child_resource->get_scene_unique_id() == "child_id");
+	const Ref<Resource> loaded_new_child_resource = loaded_resource->get_meta("new_child");
+	REQUIRE(loaded_new_child_resource.is_valid());
+	CHECK(loaded_new_child_resource->get_scene_unique_id() == new_child_resource->get_scene_unique_id());
+}
+
+TEST_CASE("[Resource] Prefetching recorded dependencies") {
+	DirAccess::make_dir_recursive_absolute(OS::get_singleton()->get_user_data_dir());
+	const String manifest_path = "user://main_scene_prefetch.cfg";
+	const String main_path = TestUtils::get_temp_path("prefetch_main.tres");
+	const String dependency_path = TestUtils::get_temp_path("prefetch_dependency.tres");
+	{
+		Ref<Resource> dependency = memnew(Resource);
+		dependency->set_name("Dependency");
+		REQUIRE(ResourceSaver::save(dependency, dependency_path) == OK);
+		dependency->set_path(dependency_path);
+
+		Ref<Resource> main = memnew(Resource);
+		main->set_meta("dependency", dependency);
+		REQUIRE(ResourceSaver::save(main, main_path) == OK);
+	}
+
+	// The first load records the dependencies.
+	ResourceLoader::prefetch_dependencies_begin(main_path);
+	Ref<Resource> loaded = ResourceLoader::load(main_path);
+	ResourceLoader::prefetch_dependencies_end();
+	REQUIRE(loaded.is_valid());
+	loaded.unref();
+
+	Ref<ConfigFile> manifest;
+	manifest.instantiate();
+	REQUIRE(manifest->load(manifest_path) == OK);
+	CHECK(manifest->get_value("prefetch", "scene") == main_path);
+	const PackedStringArray resources = manifest->get_value("prefetch", "resources");
+	CHECK(resources == PackedStringArray({ dependency_path }));
+
+	// The next one requests them up front.
+	ResourceLoader::prefetch_dependencies_begin(main_path);
+	CHECK(ResourceLoader::load_threaded_get_status(dependency_path) != ResourceLoader::THREAD_LOAD_INVALID_RESOURCE);
+	loaded = ResourceLoader::load(main_path);
+	ResourceLoader::prefetch_dependencies_end();
+	REQUIRE(loaded.is_valid());
+	const Ref<Resource> loaded_dependency = loaded->get_meta("dependency");
+	REQUIRE(loaded_dependency.is_valid());
+	CHECK(loaded_dependency->get_name() == "Dependency");
+	CHECK(ResourceLoader::load_threaded_get_status(dependency_path) == ResourceLoader::THREAD_LOAD_INVALID_RESOURCE);
+
+	DirAccess::remove_absolute(manifest_path);
+}
+
+TEST_CASE("[Resource] Caching binary translations of text resources") {
+	DirAccess::make_dir_recursive_absolute(OS::get_singleton()->get_user_data_dir());
+	const bool was_enabled = ResourceFormatLoaderText::singleton->is_binary_cache_enabled();
+	ResourceFormatLoaderText::singleton->set_binary_cache_enabled(true);
+
+	const String save_path = TestUtils::get_temp_path("resource_binary_cache.tres");
+	const String cache_path = String("user://text_resource_cache").path_join(ProjectSettings::get_singleton()->localize_path(save_path).md5_text());
+	Ref<Resource> resource = memnew(Resource);
+	Ref<Resource> child_resource = memnew(Resource);
+	child_resource->set_name("Child");
+	resource->set_meta("child", child_resource);
+
+	resource->set_name("First");
+	REQUIRE(ResourceSaver::save(resource, save_path) == OK);
+
+	// The first load parses the text and caches it.
+	Ref<Resource> loaded = ResourceLoader::load(save_path, "", ResourceFormatLoader::CACHE_MODE_IGNORE);
+	REQUIRE(loaded.is_valid());
+	CHECK(loaded->get_name() == "First");
+	CHECK(FileAccess::exists(cache_path + ".res"));
+
+	// The next one reads the cached binary file.
+	loaded = ResourceLoader::load(save_path, "", ResourceFormatLoader::CACHE_MODE_IGNORE);
+	REQUIRE(loaded.is_valid());
+	CHECK(loaded->get_name() == "First");
+	const Ref<Resource> loaded_child_resource = loaded->get_meta("child");
+	REQUIRE(loaded_child_resource.is_valid());
+	CHECK(loaded_child_resource->get_name() == "Child");
+
+	// Changing the text file invalidates the cache.
+	resource->set_name("Second");
+	REQUIRE(ResourceSaver::save(resource, save_path) == OK);
+	loaded = ResourceLoader::load(save_path, "", ResourceFormatLoader::CACHE_MODE_IGNORE);
+	REQUIRE(loaded.is_valid());
+	CHECK(loaded->get_name() == "Second");
+
+	ResourceFormatLoaderText::singleton->set_binary_cache_enabled(was_enabled);
+	DirAccess::remove_absolute(cache_path + ".res");
+	DirAccess::remove_absolute(cache_path + ".key");
+}
 } // namespace TestResource
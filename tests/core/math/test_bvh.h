@@ -0,0 +1,117 @@
+/**************************************************************************/
+/*  test_bvh.h                                                            */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             REDOT ENGINE                               */
+/*                        https://redotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2024-present Redot Engine contributors                   */
+/*                                          (see REDOT_AUTHORS.md)        */
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+
+#include "core/math/bvh.h"
+#include "core/math/random_pcg.h"
+
+#include "tests/test_macros.h"
+
+namespace TestBVH {
+
+struct Item {
+	int id = 0;
+};
+
+template <typename T>
+class PairAll {
+public:
+	static bool user_pair_check(const T *p_a, const T *p_b) { return true; }
+};
+
+template <typename T>
+class CullAll {
+public:
+	static bool user_cull_check(const T *p_a, const T *p_b) { return true; }
+};
+
+typedef BVH_Manager<Item, 1, true, 32, PairAll<Item>, CullAll<Item>> PairingBVH;
+
+static void *record_pair(void *p_log, uint32_t p_a, Item *p_item_a, int p_subindex_a, uint32_t p_b, Item *p_item_b, int p_subindex_b) {
+	((LocalVector<Vector2i> *)p_log)->push_back(Vector2i(p_item_a->id, p_item_b->id));
+	return nullptr;
+}
+
+static void record_unpair(void *p_log, uint32_t p_a, Item *p_item_a, int p_subindex_a, uint32_t p_b, Item *p_item_b, int p_subindex_b, void *p_pair_data) {
+	((LocalVector<Vector2i> *)p_log)->push_back(Vector2i(-p_item_a->id, -p_item_b->id));
+}
+
+// Moves the same items randomly in both trees for a few frames, logging every pair and unpair callback.
+static void simulate_pairing(bool p_threaded, LocalVector<Vector2i> &r_log) {
+	const int item_count = 500;
+
+	PairingBVH bvh;
+	bvh.params_set_threaded_pairing(p_threaded);
+	bvh.set_pair_callback(record_pair, &r_log);
+	bvh.set_unpair_callback(record_unpair, &r_log);
+
+	RandomPCG rng(12345);
+	LocalVector<Item> items;
+	items.resize(item_count);
+	LocalVector<BVHHandle> handles;
+	for (int i = 0; i < item_count; i++) {
+		items[i].id = i + 1;
+		const Vector3 position(rng.random(-50.0f, 50.0f), rng.random(-50.0f, 50.0f), rng.random(-50.0f, 50.0f));
+		handles.push_back(bvh.create(&items[i], true, 0, 1, AABB(position, Vector3(2, 2, 2))));
+	}
+	bvh.update();
+
+	for (int frame = 0; frame < 5; frame++) {
+		for (int i = 0; i < item_count; i++) {
+			const Vector3 position(rng.random(-50.0f, 50.0f), rng.random(-50.0f, 50.0f), rng.random(-50.0f, 50.0f));
+			bvh.move(handles[i], AABB(position, Vector3(2, 2, 2)));
+		}
+		bvh.update();
+	}
+
+	for (const BVHHandle &handle : handles) {
+		bvh.erase(handle);
+	}
+}
+
+TEST_CASE("[BVH] Threaded pairing sends the same callbacks in the same order") {
+	LocalVector<Vector2i> serial_log;
+	LocalVector<Vector2i> threaded_log;
+	simulate_pairing(false, serial_log);
+	simulate_pairing(true, threaded_log);
+
+	CHECK(serial_log.size() > 0);
+	REQUIRE(serial_log.size() == threaded_log.size());
+	bool same_order = true;
+	for (uint32_t i = 0; i < serial_log.size(); i++) {
+		same_order &= serial_log[i] == threaded_log[i];
+	}
+	CHECK_MESSAGE(same_order, "Pair callbacks should be identical with and without threaded pairing.");
+}
+
+} // namespace TestBVH
@@ -0,0 +1,108 @@
+/**************************************************************************/
+/*  test_message_queue.h                                                  */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             REDOT ENGINE                               */
+/*                        https://redotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2024-present Redot Engine contributors                   */
+/*                                          (see REDOT_AUTHORS.md)        */
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+
+#include "core/config/project_settings.h"
+#include "core/object/message_queue.h"
+#include "core/os/thread.h"
+
+#include "tests/test_macros.h"
+
+namespace TestMessageQueue {
+
+static LocalVector<int> called_values;
+
+static void record_value(int p_value) {
+	called_values.push_back(p_value);
+}
+
+static void push_from_thread(void *p_count) {
+	const int count = *(int *)p_count;
+	for (int i = 0; i < count; i++) {
+		MessageQueue::get_singleton()->push_callable(callable_mp_static(&record_value), i);
+	}
+}
+
+TEST_CASE("[MessageQueue] Messages pushed from other threads keep the push order") {
+	MessageQueue *message_queue = memnew(MessageQueue);
+	called_values.clear();
+
+	int count = 100;
+	message_queue->push_callable(callable_mp_static(&record_value), -1);
+	Thread thread;
+	thread.start(&push_from_thread, &count);
+	thread.wait_to_finish();
+	message_queue->push_callable(callable_mp_static(&record_value), -2);
+	message_queue->flush();
+
+	REQUIRE(called_values.size() == uint32_t(count + 2));
+	CHECK(called_values[0] == -1);
+	CHECK_MESSAGE(called_values[count + 1] == -2, "Without staging, messages should be called in the order they were pushed from all threads.");
+
+	memdelete(message_queue);
+	called_values.clear();
+}
+
+TEST_CASE("[MessageQueue] Messages staged from other threads are called when flushing") {
+	ProjectSettings::get_singleton()->set_setting("threading/message_queue/stage_thread_pushes", true);
+	MessageQueue *message_queue = memnew(MessageQueue);
+	ProjectSettings::get_singleton()->set_setting("threading/message_queue/stage_thread_pushes", false);
+	called_values.clear();
+
+	// Enough messages to span several pages.
+	int count = 1000;
+	message_queue->push_callable(callable_mp_static(&record_value), -1);
+
+	Thread thread;
+	thread.start(&push_from_thread, &count);
+	thread.wait_to_finish();
+
+	CHECK_MESSAGE(called_values.is_empty(), "Nothing should be called before flushing.");
+	message_queue->flush();
+
+	REQUIRE(called_values.size() == uint32_t(count + 1));
+	CHECK(called_values[0] == -1);
+	bool in_order = true;
+	for (int i = 0; i < count; i++) {
+		in_order &= called_values[i + 1] == i;
+	}
+	CHECK_MESSAGE(in_order, "Messages from a thread should be called in the order it pushed them.");
+
+	message_queue->flush();
+	CHECK_MESSAGE(called_values.size() == uint32_t(count + 1), "Messages should only be called once.");
+
+	memdelete(message_queue);
+	called_values.clear();
+}
+
+} // namespace TestMessageQueue
@@ -562,4 +562,96 @@ TEST_CASE("[CommandQueue] Test Parameter Passing Semantics") {
 
 	sts.destroy_threads();
 }
+
+struct ProducerTestState {
+	CommandQueueMT command_queue;
+	Mutex push_mutex;
+	uint32_t pushed_count = 0;
+	uint32_t commands_per_producer = 0;
+	bool ordered_pushes = false;
+	SafeFlag producers_done;
+
+	LocalVector<uint32_t> called_values;
+	SafeNumeric<uint32_t> called_count;
+
+	void record(uint32_t p_value) {
+		called_values.push_back(p_value);
+	}
+	void count(uint32_t p_value) {
+		called_count.increment();
+	}
+
+	void produce() {
+		for (uint32_t i = 0; i < commands_per_producer; i++) {
+			if (ordered_pushes) {
+				// The mutex orders the pushes between the producers, which the calls must preserve.
+				MutexLock lock(push_mutex);
+				command_queue.push(this, &ProducerTestState::record, pushed_count++);
+			} else {
+				command_queue.push(this, &ProducerTestState::count, i);
+			}
+		}
+	}
+	static void static_produce(void *p_state) {
+		static_cast<ProducerTestState *>(p_state)->produce();
+	}
+
+	void consume() {
+		while (!producers_done.is_set()) {
+			command_queue.flush_if_pending();
+		}
+		command_queue.flush_all();
+	}
+	static void static_consume(void *p_state) {
+		static_cast<ProducerTestState *>(p_state)->consume();
+	}
+
+	// Returns the time spent pushing and flushing, in microseconds.
+	uint64_t run(int p_producer_count) {
+		Thread consumer;
+		LocalVector<Thread> producers;
+		producers.resize(p_producer_count);
+
+		const uint64_t begin_usec = OS::get_singleton()->get_ticks_usec();
+		consumer.start(&ProducerTestState::static_consume, this);
+		for (Thread &producer : producers) {
+			producer.start(&ProducerTestState::static_produce, this);
+		}
+		for (Thread &producer : producers) {
+			producer.wait_to_finish();
+		}
+		producers_done.set();
+		consumer.wait_to_finish();
+		return MAX(OS::get_singleton()->get_ticks_usec() - begin_usec, (uint64_t)1);
+	}
+};
+
+TEST_CASE("[CommandQueue] Commands from several producers are called in push order") {
+	ProducerTestState state;
+	state.commands_per_producer = 2000;
+	state.ordered_pushes = true;
+	state.run(4);
+
+	REQUIRE(state.called_values.size() == 4 * state.commands_per_producer);
+	bool in_order = true;
+	for (uint32_t i = 0; i < state.called_values.size(); i++) {
+		in_order &= state.called_values[i] == i;
+	}
+	CHECK_MESSAGE(in_order, "Commands ordered between producers should be called in that order.");
+}
+
+TEST_CASE("[CommandQueue] Benchmark contended pushes against producer count") {
+	const uint32_t commands_per_producer = 20000;
+	const int max_producers = MAX(1, OS::get_singleton()->get_processor_count());
+
+	for (int producer_count = 1; producer_count <= max_producers; producer_count *= 2) {
+		ProducerTestState state;
+		state.commands_per_producer = commands_per_producer;
+		const uint64_t elapsed_usec = state.run(producer_count);
+
+		const uint32_t total_commands = commands_per_producer * producer_count;
+		CHECK(state.called_count.get() == total_commands);
+		MESSAGE(vformat("%d producer(s): %d commands/s.", producer_count, (int64_t)(total_commands * 1000000.0 / elapsed_usec)));
+	}
+}
 } // namespace TestCommandQueue
@@ -174,4 +174,114 @@ TEST_CASE("[WorkerThreadPool] Run a yielding daemon as the only hope for other t
 	CHECK_MESSAGE(all_needed_yield, "All legit tasks should have needed the daemon yielding to run.");
 }
 
+static SafeNumeric<uint32_t> sequence;
+static uint32_t order[4];
+
+static void static_sequenced_test(void *p_arg) {
+	order[(uintptr_t)p_arg] = sequence.increment();
+}
+
+static void static_sequenced_group_test(void *p_arg, uint32_t p_index) {
+	counter[p_index].increment();
+	if (p_index == 0) {
+		order[(uintptr_t)p_arg] = sequence.increment();
+	}
+}
+
+TEST_CASE("[WorkerThreadPool] Run tasks and group tasks after their dependencies") {
+	for (int iterations = 0; iterations < 100; iterations++) {
+		const int count = Math::pow(2.0f, Math::random(0.0f, 5.0f));
+		const bool low_priority = Math::rand() % 2;
+
+		sequence.set(0);
+		counter.clear();
+		counter.resize(count);
+
+		// Diamond: first -> (group, second) -> last.
+		WorkerThreadPool::TaskID first = WorkerThreadPool::get_singleton()->add_native_task(static_sequenced_test, (void *)0, !low_priority);
+		const WorkerThreadPool::TaskID first_dependency[] = { first };
+		WorkerThreadPool::GroupID group = WorkerThreadPool::get_singleton()->add_native_dependent_group_task(static_sequenced_group_test, (void *)1, count, first_dependency, -1, low_priority);
+		WorkerThreadPool::TaskID second = WorkerThreadPool::get_singleton()->add_native_dependent_task(static_sequenced_test, (void *)2, first_dependency, !low_priority);
+		const WorkerThreadPool::TaskID last_dependencies[] = { group, second };
+		WorkerThreadPool::TaskID last = WorkerThreadPool::get_singleton()->add_native_dependent_task(static_sequenced_test, (void *)3, last_dependencies, low_priority);
+
+		WorkerThreadPool::get_singleton()->wait_for_task_completion(last);
+		CHECK(WorkerThreadPool::get_singleton()->is_task_completed(second));
+		CHECK(WorkerThreadPool::get_singleton()->is_group_task_completed(group));
+		WorkerThreadPool::get_singleton()->wait_for_task_completion(second);
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group);
+		WorkerThreadPool::get_singleton()->wait_for_task_completion(first);
+
+		CHECK(order[0] < order[1]);
+		CHECK(order[0] < order[2]);
+		CHECK(order[1] < order[3]);
+		CHECK(order[2] < order[3]);
+
+		bool all_run_once = true;
+		for (int i = 0; i < count; i++) {
+			all_run_once &= counter[i].get() == 1;
+		}
+		CHECK(all_run_once);
+	}
+}
+
+TEST_CASE("[WorkerThreadPool] Depending on an already awaited task") {
+	sequence.set(0);
+	WorkerThreadPool::TaskID first = WorkerThreadPool::get_singleton()->add_native_task(static_sequenced_test, (void *)0, true);
+	WorkerThreadPool::get_singleton()->wait_for_task_completion(first);
+
+	const WorkerThreadPool::TaskID dependencies[] = { first };
+	WorkerThreadPool::TaskID second = WorkerThreadPool::get_singleton()->add_native_dependent_task(static_sequenced_test, (void *)1, dependencies, true);
+	CHECK(WorkerThreadPool::get_singleton()->wait_for_task_completion(second) == OK);
+	CHECK(order[0] < order[1]);
+}
+
+struct BenchmarkData {
+	WorkerThreadPool *pool = nullptr;
+	uint32_t tasks_per_producer = 0;
+	SafeNumeric<uint32_t> completed;
+};
+
+static void static_benchmark_task(void *p_arg) {
+	((BenchmarkData *)p_arg)->completed.increment();
+}
+
+static void static_benchmark_producer(void *p_arg, uint32_t p_index) {
+	// Posting from a pool thread, which exercises the lock-free work-stealing path.
+	BenchmarkData *data = (BenchmarkData *)p_arg;
+	LocalVector<WorkerThreadPool::TaskID> task_ids;
+	task_ids.resize(data->tasks_per_producer);
+	for (uint32_t i = 0; i < data->tasks_per_producer; i++) {
+		task_ids[i] = data->pool->add_native_task(static_benchmark_task, data, true);
+	}
+	for (uint32_t i = 0; i < data->tasks_per_producer; i++) {
+		data->pool->wait_for_task_completion(task_ids[i]);
+	}
+}
+
+TEST_CASE("[WorkerThreadPool] Benchmark task throughput against thread count") {
+	const uint32_t tasks_per_producer = 2000;
+	const int max_threads = MAX(1, OS::get_singleton()->get_processor_count());
+
+	for (int thread_count = 1; thread_count <= max_threads; thread_count *= 2) {
+		WorkerThreadPool *pool = memnew(WorkerThreadPool(false));
+		pool->init(thread_count);
+
+		BenchmarkData data;
+		data.pool = pool;
+		data.tasks_per_producer = tasks_per_producer;
+
+		const uint64_t begin_usec = OS::get_singleton()->get_ticks_usec();
+		WorkerThreadPool::GroupID group = pool->add_native_group_task(static_benchmark_producer, &data, thread_count, thread_count, true);
+		pool->wait_for_group_task_completion(group);
+		const uint64_t elapsed_usec = MAX(OS::get_singleton()->get_ticks_usec() - begin_usec, (uint64_t)1);
+
+		const uint32_t total_tasks = tasks_per_producer * thread_count;
+		CHECK(data.completed.get() == total_tasks);
+		MESSAGE(vformat("%d thread(s): %d tasks/s.", thread_count, (int64_t)(total_tasks * 1000000.0 / elapsed_usec)));
+
+		memdelete(pool);
+	}
+}
+
 } // namespace TestWorkerThreadPool
@@ -1786,6 +1786,27 @@ TEST_CASE("[Variant] Writer and parser array") {
 	CHECK_MESSAGE(a_parsed == Variant(a), "Should parse back.");
 }
 
+TEST_CASE("[Variant] Parser strings and numbers longer than the read-ahead buffer") {
+	String long_string;
+	for (int i = 0; i < 1000; i++) {
+		long_string += vformat("line %d \"quoted\" \\ tab\t\n", i);
+	}
+	const Array a = { long_string, 12345678901234, -0.000123456789, 1.5e10, StringName(long_string) };
+	String a_str;
+	VariantWriter::write_to_string(a, a_str);
+
+	VariantParser::StreamString ss;
+	String errs;
+	int line = 1;
+	Variant a_parsed;
+
+	ss.s = a_str;
+	CHECK(VariantParser::parse(&ss, a_parsed, errs, line) == OK);
+	CHECK_MESSAGE(a_parsed == Variant(a), "Should parse back.");
+	// Newlines inside strings still count towards the line number.
+	CHECK(line == a_str.count("\n") + 1);
+}
+
 TEST_CASE("[Variant] Writer recursive array") {
 	// There is no way to accurately represent a recursive array,
 	// the only thing we can do is make sure the writer doesn't blow up
@@ -310,4 +310,80 @@ TEST_CASE("[Animation] Create Bezier track") {
 	ERR_PRINT_ON;
 }
 
+TEST_CASE("[Animation] Sample compressed tracks at once") {
+	Ref<Animation> animation = memnew(Animation);
+	animation->set_length(2.0);
+	// Enough tracks to exercise both the vectorized lanes and the remainder.
+	for (int i = 0; i < 5; i++) {
+		const int position_track = animation->add_track(Animation::TYPE_POSITION_3D);
+		animation->track_set_path(position_track, NodePath(vformat("Skeleton:bone_%d", i)));
+		animation->position_track_insert_key(position_track, 0.0, Vector3(i, 0, -i));
+		animation->position_track_insert_key(position_track, 1.0, Vector3(0, i * 2, 1));
+		animation->position_track_insert_key(position_track, 2.0, Vector3(-i, 1, 0));
+
+		const int rotation_track = animation->add_track(Animation::TYPE_ROTATION_3D);
+		animation->track_set_path(rotation_track, NodePath(vformat("Skeleton:bone_%d", i)));
+		animation->rotation_track_insert_key(rotation_track, 0.0, Quaternion(Vector3(0, 1, 0), 0.3 * i));
+		animation->rotation_track_insert_key(rotation_track, 2.0, Quaternion(Vector3(1, 0, 0), 0.5 * i));
+
+		const int scale_track = animation->add_track(Animation::TYPE_SCALE_3D);
+		animation->track_set_path(scale_track, NodePath(vformat("Skeleton:bone_%d", i)));
+		animation->scale_track_insert_key(scale_track, 0.0, Vector3(1, 1, 1));
+		animation->scale_track_insert_key(scale_track, 2.0, Vector3(1 + i, 2, 0.5));
+	}
+	const int blend_shape_track = animation->add_track(Animation::TYPE_BLEND_SHAPE);
+	animation->track_set_path(blend_shape_track, NodePath("Mesh:blend_shape"));
+	animation->blend_shape_track_insert_key(blend_shape_track, 0.0, -1.0);
+	animation->blend_shape_track_insert_key(blend_shape_track, 2.0, 1.0);
+	const int value_track = animation->add_track(Animation::TYPE_VALUE);
+	animation->track_set_path(value_track, NodePath("Mesh:visible"));
+	animation->track_insert_key(value_track, 0.0, true);
+
+	animation->compress();
+	CHECK(animation->is_compressed());
+	CHECK(animation->track_is_compressed(0));
+
+	Animation::CompressedTrackSamples samples;
+	for (double time = 0.0; time <= 2.0; time += 0.15) {
+		animation->sample_compressed_tracks(time, samples);
+		for (int i = 0; i < animation->get_track_count(); i++) {
+			switch (animation->track_get_type(i)) {
+				case Animation::TYPE_POSITION_3D: {
+					Vector3 expected;
+					Vector3 sampled;
+					REQUIRE(animation->try_position_track_interpolate(i, time, &expected) == OK);
+					REQUIRE(samples.get_vector3(i, &sampled) == OK);
+					CHECK(sampled.is_equal_approx(expected));
+				} break;
+				case Animation::TYPE_ROTATION_3D: {
+					Quaternion expected;
+					Quaternion sampled;
+					REQUIRE(animation->try_rotation_track_interpolate(i, time, &expected) == OK);
+					REQUIRE(samples.get_quaternion(i, &sampled) == OK);
+					CHECK(sampled.is_equal_approx(expected));
+				} break;
+				case Animation::TYPE_SCALE_3D: {
+					Vector3 expected;
+					Vector3 sampled;
+					REQUIRE(animation->try_scale_track_interpolate(i, time, &expected) == OK);
+					REQUIRE(samples.get_vector3(i, &sampled) == OK);
+					CHECK(sampled.is_equal_approx(expected));
+				} break;
+				case Animation::TYPE_BLEND_SHAPE: {
+					float expected = 0.0;
+					float sampled = 0.0;
+					REQUIRE(animation->try_blend_shape_track_interpolate(i, time, &expected) == OK);
+					REQUIRE(samples.get_float(i, &sampled) == OK);
+					CHECK(sampled == doctest::Approx(expected));
+				} break;
+				default: {
+					// Other track types are not sampled.
+					float unused = 0.0;
+					CHECK(samples.get_float(i, &unused) == ERR_UNAVAILABLE);
+				} break;
+			}
+		}
+	}
+}
+
 } // namespace TestAnimation
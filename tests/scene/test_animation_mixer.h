@@ -0,0 +1,156 @@
+/**************************************************************************/
+/*  test_animation_mixer.h                                                */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             REDOT ENGINE                               */
+/*                        https://redotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2024-present Redot Engine contributors                   */
+/*                                          (see REDOT_AUTHORS.md)        */
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+
+#include "core/config/project_settings.h"
+#include "scene/3d/node_3d.h"
+#include "scene/animation/animation_player.h"
+#include "scene/main/window.h"
+
+#include "tests/test_macros.h"
+
+namespace TestAnimationMixer {
+
+static const char *BATCH_SETTING = "animation/thread_model/blend_use_multiple_threads";
+static const int TARGETS_PER_MEMBER = 8;
+
+static Ref<Animation> create_crowd_animation() {
+	Ref<Animation> animation;
+	animation.instantiate();
+	animation->set_length(1.0);
+	animation->set_loop_mode(Animation::LOOP_LINEAR);
+	for (int i = 0; i < TARGETS_PER_MEMBER; i++) {
+		const NodePath path = vformat("Target%d", i);
+
+		int track = animation->add_track(Animation::TYPE_POSITION_3D);
+		animation->track_set_path(track, path);
+		animation->position_track_insert_key(track, 0.0, Vector3());
+		animation->position_track_insert_key(track, 1.0, Vector3(1, 2, 3) * (i + 1));
+
+		track = animation->add_track(Animation::TYPE_ROTATION_3D);
+		animation->track_set_path(track, path);
+		animation->rotation_track_insert_key(track, 0.0, Quaternion());
+		animation->rotation_track_insert_key(track, 1.0, Quaternion(Vector3(0, 1, 0), Math::PI * 0.5));
+
+		track = animation->add_track(Animation::TYPE_SCALE_3D);
+		animation->track_set_path(track, path);
+		animation->scale_track_insert_key(track, 0.0, Vector3(1, 1, 1));
+		animation->scale_track_insert_key(track, 1.0, Vector3(2, 2, 2));
+	}
+	return animation;
+}
+
+// Builds `p_count` members, each made of some animated targets and the AnimationPlayer driving them.
+static Node3D *create_crowd(const Ref<Animation> &p_animation, int p_count) {
+	Ref<AnimationLibrary> library;
+	library.instantiate();
+	library->add_animation("walk", p_animation);
+
+	Node3D *crowd = memnew(Node3D);
+	for (int i = 0; i < p_count; i++) {
+		Node3D *member = memnew(Node3D);
+		crowd->add_child(member);
+		for (int j = 0; j < TARGETS_PER_MEMBER; j++) {
+			Node3D *target = memnew(Node3D);
+			target->set_name(vformat("Target%d", j));
+			member->add_child(target);
+		}
+		AnimationPlayer *player = memnew(AnimationPlayer);
+		member->add_child(player);
+		player->add_animation_library("", library);
+	}
+	SceneTree::get_singleton()->get_root()->add_child(crowd);
+	for (int i = 0; i < p_count; i++) {
+		AnimationPlayer *player = Object::cast_to<AnimationPlayer>(crowd->get_child(i)->get_child(TARGETS_PER_MEMBER));
+		player->play("walk");
+	}
+	return crowd;
+}
+
+TEST_CASE("[SceneTree][AnimationMixer] Blending in a batch gives the same results as blending one by one") {
+	Ref<Animation> animation = create_crowd_animation();
+
+	ProjectSettings::get_singleton()->set_setting(BATCH_SETTING, false);
+	Node3D *serial = create_crowd(animation, 8);
+	for (int frame = 0; frame < 4; frame++) {
+		SceneTree::get_singleton()->process(0.1);
+	}
+	SceneTree::get_singleton()->get_root()->remove_child(serial);
+
+	ProjectSettings::get_singleton()->set_setting(BATCH_SETTING, true);
+	Node3D *batched = create_crowd(animation, 8);
+	for (int frame = 0; frame < 4; frame++) {
+		SceneTree::get_singleton()->process(0.1);
+	}
+	ProjectSettings::get_singleton()->set_setting(BATCH_SETTING, false);
+
+	Node3D *batched_target = Object::cast_to<Node3D>(batched->get_child(0)->get_child(TARGETS_PER_MEMBER - 1));
+	CHECK_FALSE(batched_target->get_position().is_zero_approx());
+
+	bool all_equal = true;
+	for (int i = 0; i < serial->get_child_count(); i++) {
+		for (int j = 0; j < TARGETS_PER_MEMBER; j++) {
+			Node3D *a = Object::cast_to<Node3D>(serial->get_child(i)->get_child(j));
+			Node3D *b = Object::cast_to<Node3D>(batched->get_child(i)->get_child(j));
+			all_equal &= a->get_transform().is_equal_approx(b->get_transform());
+		}
+	}
+	CHECK_MESSAGE(all_equal, "Batched and serial blending should produce the same poses.");
+
+	memdelete(serial);
+	memdelete(batched);
+}
+
+TEST_CASE("[SceneTree][AnimationMixer] Benchmark blending throughput") {
+	const int mixer_count = 300;
+	const int frame_count = 10;
+	Ref<Animation> animation = create_crowd_animation();
+
+	for (int batched = 0; batched < 2; batched++) {
+		ProjectSettings::get_singleton()->set_setting(BATCH_SETTING, batched == 1);
+		Node3D *crowd = create_crowd(animation, mixer_count);
+
+		const uint64_t begin_usec = OS::get_singleton()->get_ticks_usec();
+		for (int frame = 0; frame < frame_count; frame++) {
+			SceneTree::get_singleton()->process(1.0 / 60.0);
+		}
+		const double elapsed_msec = MAX(OS::get_singleton()->get_ticks_usec() - begin_usec, (uint64_t)1) / 1000.0;
+
+		MESSAGE(vformat("%s blending: %.1f mixers/ms.", batched == 1 ? "Batched" : "Serial", mixer_count * frame_count / elapsed_msec));
+
+		memdelete(crowd);
+	}
+	ProjectSettings::get_singleton()->set_setting(BATCH_SETTING, false);
+}
+
+} // namespace TestAnimationMixer
@@ -32,7 +32,10 @@
 
 #pragma once
 
+#include "core/config/engine.h"
+#include "scene/2d/node_2d.h"
 #include "scene/resources/packed_scene.h"
+#include "scene/scene_string_names.h"
 
 #include "tests/test_macros.h"
 
@@ -282,4 +285,132 @@ TEST_CASE("[PackedScene] Recreate State") {
 	memdelete(scene);
 }
 
+// Scene similar to a spawned projectile: a few 2D nodes with transforms and flags set.
+static Node *_create_projectile_scene() {
+	Node2D *root = memnew(Node2D);
+	root->set_name("Projectile");
+	root->set_position(Vector2(10, 20));
+	root->set_rotation(0.5);
+	root->set_z_index(3);
+
+	for (int i = 0; i < 4; i++) {
+		Node2D *child = memnew(Node2D);
+		child->set_name(vformat("Part%d", i));
+		child->set_position(Vector2(i, -i));
+		child->set_scale(Vector2(2, 2));
+		child->set_visible(i % 2 == 0);
+		child->set_process_priority(i);
+		root->add_child(child);
+		child->set_owner(root);
+	}
+	return root;
+}
+
+TEST_CASE("[PackedScene] Instantiate Packed Scene Repeatedly") {
+	Node *scene = _create_projectile_scene();
+	PackedScene packed_scene;
+	REQUIRE(packed_scene.pack(scene) == OK);
+	memdelete(scene);
+
+	// Instances after the first one reuse the instantiation plan.
+	for (int instance = 0; instance < 3; instance++) {
+		Node2D *root = Object::cast_to<Node2D>(packed_scene.instantiate());
+		REQUIRE(root != nullptr);
+		CHECK(root->get_name() == "Projectile");
+		CHECK(root->get_position() == Vector2(10, 20));
+		CHECK(root->get_rotation() == doctest::Approx(0.5));
+		CHECK(root->get_z_index() == 3);
+		REQUIRE(root->get_child_count() == 4);
+
+		for (int i = 0; i < 4; i++) {
+			Node2D *child = Object::cast_to<Node2D>(root->get_child(i));
+			REQUIRE(child != nullptr);
+			CHECK(child->get_name() == vformat("Part%d", i));
+			CHECK(child->get_owner() == root);
+			CHECK(child->get_position() == Vector2(i, -i));
+			CHECK(child->get_scale() == Vector2(2, 2));
+			CHECK(child->is_visible() == (i % 2 == 0));
+			CHECK(child->get_process_priority() == i);
+		}
+		memdelete(root);
+	}
+
+	// Packing again replaces the plan.
+	Node2D *changed_scene = memnew(Node2D);
+	changed_scene->set_position(Vector2(5, 5));
+	REQUIRE(packed_scene.pack(changed_scene) == OK);
+	memdelete(changed_scene);
+
+	Node2D *root = Object::cast_to<Node2D>(packed_scene.instantiate());
+	REQUIRE(root != nullptr);
+	CHECK(root->get_position() == Vector2(5, 5));
+	CHECK(root->get_child_count() == 0);
+	memdelete(root);
+}
+
+static void _check_same_tree(Node *p_node, Node *p_expected, Node *p_root, Node *p_expected_root) {
+	CHECK(p_node->get_class() == p_expected->get_class());
+	CHECK(p_node->get_name() == p_expected->get_name());
+	if (p_expected->get_owner()) {
+		REQUIRE(p_node->get_owner() != nullptr);
+		CHECK(p_root->get_path_to(p_node->get_owner()) == p_expected_root->get_path_to(p_expected->get_owner()));
+	} else {
+		CHECK(p_node->get_owner() == nullptr);
+	}
+
+	List<PropertyInfo> properties;
+	p_expected->get_property_list(&properties);
+	for (const PropertyInfo &E : properties) {
+		if (E.usage & PROPERTY_USAGE_STORAGE) {
+			INFO(vformat("Property '%s' of '%s'.", E.name, p_expected->get_name()));
+			CHECK(p_node->get(E.name) == p_expected->get(E.name));
+		}
+	}
+
+	List<Object::Connection> connections;
+	p_node->get_all_signal_connections(&connections);
+	List<Object::Connection> expected_connections;
+	p_expected->get_all_signal_connections(&expected_connections);
+	REQUIRE(connections.size() == expected_connections.size());
+	for (List<Object::Connection>::Element *E = connections.front(), *F = expected_connections.front(); E; E = E->next(), F = F->next()) {
+		CHECK(E->get().signal.get_name() == F->get().signal.get_name());
+		CHECK(E->get().callable.get_method() == F->get().callable.get_method());
+		CHECK(p_root->get_path_to(Object::cast_to<Node>(E->get().callable.get_object())) == p_expected_root->get_path_to(Object::cast_to<Node>(F->get().callable.get_object())));
+		CHECK(E->get().flags == F->get().flags);
+	}
+
+	REQUIRE(p_node->get_child_count() == p_expected->get_child_count());
+	for (int i = 0; i < p_expected->get_child_count(); i++) {
+		_check_same_tree(p_node->get_child(i), p_expected->get_child(i), p_root, p_expected_root);
+	}
+}
+
+TEST_CASE("[PackedScene] Instantiation plan builds the same tree") {
+	Node *scene = _create_projectile_scene();
+	// Also properties and connections the plan leaves to the regular path.
+	Node *part = scene->get_child(1);
+	part->set_meta("damage", 25);
+	part->add_to_group("parts", true);
+	part->connect(SceneStringName(visibility_changed), Callable(scene, "queue_redraw"), Object::CONNECT_PERSIST);
+	PackedScene packed_scene;
+	REQUIRE(packed_scene.pack(scene) == OK);
+	memdelete(scene);
+
+	// The plan is skipped in the editor, which gives the tree built without it.
+	Engine::get_singleton()->set_editor_hint(true);
+	Node *expected = packed_scene.instantiate();
+	Engine::get_singleton()->set_editor_hint(false);
+	REQUIRE(expected != nullptr);
+
+	// The first instance builds the plan, the next ones use it.
+	for (int instance = 0; instance < 3; instance++) {
+		Node *root = packed_scene.instantiate();
+		REQUIRE(root != nullptr);
+		_check_same_tree(root, expected, root, expected);
+		CHECK(root->get_child(1)->is_in_group("parts"));
+		memdelete(root);
+	}
+	memdelete(expected);
+}
+
 } // namespace TestPackedScene
@@ -0,0 +1,152 @@
+/**************************************************************************/
+/*  test_scene_pool.h                                                     */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             REDOT ENGINE                               */
+/*                        https://redotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2024-present Redot Engine contributors                   */
+/*                                          (see REDOT_AUTHORS.md)        */
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+
+#include "scene/2d/node_2d.h"
+#include "scene/main/scene_pool.h"
+#include "scene/main/window.h"
+#include "scene/scene_string_names.h"
+
+#include "tests/test_macros.h"
+
+namespace TestScenePool {
+
+static Ref<PackedScene> _create_packed_scene() {
+	Node2D *root = memnew(Node2D);
+	root->set_position(Vector2(1, 2));
+	Node2D *child = memnew(Node2D);
+	child->set_name("Child");
+	child->set_rotation(0.25);
+	root->add_child(child);
+	child->set_owner(root);
+
+	Ref<PackedScene> packed_scene;
+	packed_scene.instantiate();
+	packed_scene->pack(root);
+	memdelete(root);
+	return packed_scene;
+}
+
+TEST_CASE("[SceneTree][ScenePool] Reuse released instances") {
+	Ref<PackedScene> packed_scene = _create_packed_scene();
+	Ref<ScenePool> pool;
+	pool.instantiate();
+
+	Node2D *node = Object::cast_to<Node2D>(pool->acquire(packed_scene));
+	REQUIRE(node != nullptr);
+	CHECK(pool->get_available_count(packed_scene) == 0);
+
+	SceneTree::get_singleton()->get_root()->add_child(node);
+	node->set_position(Vector2(100, 100));
+	node->set_visible(false);
+	Node2D *child = Object::cast_to<Node2D>(node->get_node(NodePath("Child")));
+	child->set_rotation(2.0);
+
+	CHECK(pool->release(node));
+	CHECK(node->get_parent() == nullptr);
+	CHECK(pool->get_available_count(packed_scene) == 1);
+
+	// Properties are back to their values from the scene.
+	CHECK(pool->acquire(packed_scene) == node);
+	CHECK(node->get_position() == Vector2(1, 2));
+	CHECK(node->is_visible());
+	CHECK(child->get_rotation() == doctest::Approx(0.25));
+
+	// Only acquired nodes can be released.
+	CHECK(pool->release(node));
+	ERR_PRINT_OFF;
+	CHECK_FALSE(pool->release(node));
+	ERR_PRINT_ON;
+	Node *other = memnew(Node);
+	ERR_PRINT_OFF;
+	CHECK_FALSE(pool->release(other));
+	ERR_PRINT_ON;
+	memdelete(other);
+}
+
+TEST_CASE("[SceneTree][ScenePool] Release while the parent is busy") {
+	Ref<PackedScene> packed_scene = _create_packed_scene();
+	Ref<ScenePool> pool;
+	pool.instantiate();
+
+	Node *node = pool->acquire(packed_scene);
+	REQUIRE(node != nullptr);
+	Node *parent = memnew(Node);
+	parent->add_child(node);
+
+	// Released as it enters the tree, while the parent is busy with its children.
+	node->connect(SceneStringName(tree_entered), callable_mp(pool.ptr(), &ScenePool::release).bind(node), Object::CONNECT_ONE_SHOT);
+	ERR_PRINT_OFF;
+	SceneTree::get_singleton()->get_root()->add_child(parent);
+	ERR_PRINT_ON;
+
+	// Nothing changed, and the node can still be released later.
+	CHECK(node->get_parent() == parent);
+	CHECK(pool->get_available_count(packed_scene) == 0);
+	CHECK(pool->release(node));
+	CHECK(node->get_parent() == nullptr);
+	CHECK(pool->get_available_count(packed_scene) == 1);
+
+	memdelete(parent);
+}
+
+TEST_CASE("[ScenePool] Prewarm and maximum size") {
+	Ref<PackedScene> packed_scene = _create_packed_scene();
+	Ref<ScenePool> pool;
+	pool.instantiate();
+	pool->set_max_size(2);
+
+	pool->prewarm(packed_scene, 5);
+	CHECK(pool->get_available_count(packed_scene) == 2);
+
+	Node *nodes[3];
+	for (int i = 0; i < 3; i++) {
+		nodes[i] = pool->acquire(packed_scene);
+		REQUIRE(nodes[i] != nullptr);
+	}
+	CHECK(pool->get_available_count(packed_scene) == 0);
+
+	// The last release goes over the maximum size, and frees the node.
+	for (int i = 0; i < 3; i++) {
+		CHECK(pool->release(nodes[i]));
+	}
+	CHECK(pool->get_available_count(packed_scene) == 2);
+
+	pool->set_max_size(1);
+	CHECK(pool->get_available_count(packed_scene) == 1);
+
+	pool->clear();
+	CHECK(pool->get_available_count(packed_scene) == 0);
+}
+
+} // namespace TestScenePool
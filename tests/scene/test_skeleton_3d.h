@@ -34,7 +34,10 @@
 
 #include "tests/test_macros.h"
 
+#include "core/config/project_settings.h"
 #include "scene/3d/skeleton_3d.h"
+#include "scene/main/window.h"
+#include "scene/scene_string_names.h"
 
 namespace TestSkeleton3D {
 
@@ -74,4 +77,112 @@ TEST_CASE("[Skeleton3D] Test per-bone meta") {
 	skeleton->set_bone_meta(0, "non-existing-key", Variant());
 	memdelete(skeleton);
 }
+
+TEST_CASE("[SceneTree][Skeleton3D] Batched updates compute global poses") {
+	const int skeleton_count = 16;
+	const int bone_count = 8;
+	ProjectSettings::get_singleton()->set_setting("animation/thread_model/skeleton_use_multiple_threads", true);
+
+	Ref<Skin> skin;
+	skin.instantiate();
+	for (int i = 0; i < bone_count; i++) {
+		skin->add_named_bind(vformat("bone_%d", i), Transform3D(Basis(), Vector3(0, -i, 0)));
+	}
+
+	Node3D *root = memnew(Node3D);
+	LocalVector<Ref<SkinReference>> skin_references;
+	for (int i = 0; i < skeleton_count; i++) {
+		Skeleton3D *skeleton = memnew(Skeleton3D);
+		for (int j = 0; j < bone_count; j++) {
+			skeleton->add_bone(vformat("bone_%d", j));
+			skeleton->set_bone_parent(j, j - 1);
+			skeleton->set_bone_rest(j, Transform3D(Basis(), Vector3(0, 1, 0)));
+		}
+		root->add_child(skeleton);
+	}
+	SceneTree::get_singleton()->get_root()->add_child(root);
+	for (int i = 0; i < skeleton_count; i++) {
+		skin_references.push_back(Object::cast_to<Skeleton3D>(root->get_child(i))->register_skin(skin));
+	}
+
+	for (int i = 0; i < skeleton_count; i++) {
+		Skeleton3D *skeleton = Object::cast_to<Skeleton3D>(root->get_child(i));
+		for (int j = 0; j < bone_count; j++) {
+			skeleton->set_bone_pose_position(j, Vector3(i, 1, 0));
+		}
+	}
+	SceneTree::get_singleton()->process(0.1);
+
+	bool all_equal = true;
+	for (int i = 0; i < skeleton_count; i++) {
+		Skeleton3D *skeleton = Object::cast_to<Skeleton3D>(root->get_child(i));
+		for (int j = 0; j < bone_count; j++) {
+			all_equal &= skeleton->get_bone_global_pose(j).origin.is_equal_approx(Vector3(i, 1, 0) * (j + 1));
+		}
+	}
+	CHECK_MESSAGE(all_equal, "Global poses of skeletons updated in a batch should match their bone hierarchy.");
+
+	ProjectSettings::get_singleton()->set_setting("animation/thread_model/skeleton_use_multiple_threads", false);
+	skin_references.clear();
+	memdelete(root);
+}
+
+class SkeletonSignalRecorder : public Object {
+public:
+	LocalVector<StringName> signals;
+
+	void record(const StringName &p_signal) {
+		signals.push_back(p_signal);
+	}
+};
+
+TEST_CASE("[SceneTree][Skeleton3D] Batched updates don't compute global poses again") {
+	const int skeleton_count = 4;
+	const int bone_count = 4;
+	ProjectSettings::get_singleton()->set_setting("animation/thread_model/skeleton_use_multiple_threads", true);
+
+	SkeletonSignalRecorder recorder;
+	Node3D *root = memnew(Node3D);
+	for (int i = 0; i < skeleton_count; i++) {
+		Skeleton3D *skeleton = memnew(Skeleton3D);
+		for (int j = 0; j < bone_count; j++) {
+			skeleton->add_bone(vformat("bone_%d", j));
+			skeleton->set_bone_parent(j, j - 1);
+			skeleton->set_bone_rest(j, Transform3D(Basis(), Vector3(0, 1, 0)));
+		}
+		root->add_child(skeleton);
+	}
+	SceneTree::get_singleton()->get_root()->add_child(root);
+	SceneTree::get_singleton()->process(0.1);
+
+	for (int i = 0; i < skeleton_count; i++) {
+		Skeleton3D *skeleton = Object::cast_to<Skeleton3D>(root->get_child(i));
+		skeleton->connect(SceneStringName(pose_updated), callable_mp(&recorder, &SkeletonSignalRecorder::record).bind(SceneStringName(pose_updated)));
+		skeleton->connect(SceneStringName(skeleton_updated), callable_mp(&recorder, &SkeletonSignalRecorder::record).bind(SceneStringName(skeleton_updated)));
+		for (int j = 0; j < bone_count; j++) {
+			skeleton->set_bone_pose_position(j, Vector3(i, 1, 0));
+		}
+	}
+	SceneTree::get_singleton()->process(0.1);
+
+	// Computing the global poses serially when beginning the update would emit `pose_updated` in between.
+	REQUIRE(recorder.signals.size() == uint32_t(skeleton_count * 2));
+	for (int i = 0; i < skeleton_count; i++) {
+		CHECK(recorder.signals[i] == SceneStringName(pose_updated));
+		CHECK(recorder.signals[skeleton_count + i] == SceneStringName(skeleton_updated));
+	}
+
+	bool all_equal = true;
+	for (int i = 0; i < skeleton_count; i++) {
+		Skeleton3D *skeleton = Object::cast_to<Skeleton3D>(root->get_child(i));
+		for (int j = 0; j < bone_count; j++) {
+			all_equal &= skeleton->get_bone_global_pose(j).origin.is_equal_approx(Vector3(i, 1, 0) * (j + 1));
+		}
+	}
+	CHECK_MESSAGE(all_equal, "Global poses of skeletons updated in a batch should match their bone hierarchy.");
+
+	ProjectSettings::get_singleton()->set_setting("animation/thread_model/skeleton_use_multiple_threads", false);
+	memdelete(root);
+}
+
 } // namespace TestSkeleton3D
@@ -0,0 +1,120 @@
+/**************************************************************************/
+/*  test_physics_server_2d.h                                              */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             REDOT ENGINE                               */
+/*                        https://redotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2024-present Redot Engine contributors                   */
+/*                                          (see REDOT_AUTHORS.md)        */
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+
+#include "servers/physics_server_2d.h"
+
+#include "tests/test_macros.h"
+
+namespace TestPhysicsServer2D {
+
+struct FallingCircle {
+	RID floor;
+	RID body;
+};
+
+// A circle dropped on a static floor, forming an island of its own once they touch.
+static FallingCircle _create_falling_circle(RID p_space, RID p_floor_shape, RID p_circle_shape, real_t p_x) {
+	PhysicsServer2D *physics_server = PhysicsServer2D::get_singleton();
+
+	FallingCircle falling_circle;
+	falling_circle.floor = physics_server->body_create();
+	physics_server->body_set_mode(falling_circle.floor, PhysicsServer2D::BODY_MODE_STATIC);
+	physics_server->body_add_shape(falling_circle.floor, p_floor_shape);
+	physics_server->body_set_state(falling_circle.floor, PhysicsServer2D::BODY_STATE_TRANSFORM, Transform2D(0, Vector2(p_x, 100)));
+	physics_server->body_set_space(falling_circle.floor, p_space);
+
+	falling_circle.body = physics_server->body_create();
+	physics_server->body_set_mode(falling_circle.body, PhysicsServer2D::BODY_MODE_RIGID);
+	physics_server->body_add_shape(falling_circle.body, p_circle_shape);
+	physics_server->body_set_state(falling_circle.body, PhysicsServer2D::BODY_STATE_TRANSFORM, Transform2D(0, Vector2(p_x, 0)));
+	physics_server->body_set_space(falling_circle.body, p_space);
+	return falling_circle;
+}
+
+TEST_CASE("[SceneTree][PhysicsServer2D] Many small islands are solved like a single one") {
+	PhysicsServer2D *physics_server = PhysicsServer2D::get_singleton();
+	physics_server->set_active(true);
+
+	RID floor_shape = physics_server->rectangle_shape_create();
+	physics_server->shape_set_data(floor_shape, Vector2(20, 5));
+	RID circle_shape = physics_server->circle_shape_create();
+	physics_server->shape_set_data(circle_shape, 5);
+
+	// Islands are independent, so how they are grouped into tasks must not change the result.
+	// A lone island is solved by itself, as every island was before they were batched.
+	RID single_space = physics_server->space_create();
+	physics_server->space_set_active(single_space, true);
+	const FallingCircle single = _create_falling_circle(single_space, floor_shape, circle_shape, 0);
+
+	// Enough islands to be split into several batches.
+	const int island_count = 300;
+	RID batched_space = physics_server->space_create();
+	physics_server->space_set_active(batched_space, true);
+	LocalVector<FallingCircle> batched;
+	for (int i = 0; i < island_count; i++) {
+		batched.push_back(_create_falling_circle(batched_space, floor_shape, circle_shape, i * 100));
+	}
+
+	// Long enough for the circles to land and bounce on their floor.
+	for (int i = 0; i < 90; i++) {
+		physics_server->step(1.0 / 60.0);
+	}
+
+	const Transform2D single_transform = physics_server->body_get_state(single.body, PhysicsServer2D::BODY_STATE_TRANSFORM);
+	const Vector2 single_velocity = physics_server->body_get_state(single.body, PhysicsServer2D::BODY_STATE_LINEAR_VELOCITY);
+	// Resting on the floor, rather than still falling or fallen through.
+	CHECK(single_transform.get_origin().y == doctest::Approx(90).epsilon(0.01));
+
+	for (int i = 0; i < island_count; i++) {
+		const Transform2D transform = physics_server->body_get_state(batched[i].body, PhysicsServer2D::BODY_STATE_TRANSFORM);
+		const Vector2 velocity = physics_server->body_get_state(batched[i].body, PhysicsServer2D::BODY_STATE_LINEAR_VELOCITY);
+		INFO(vformat("Island %d.", i));
+		CHECK(transform.get_origin().x == doctest::Approx(i * 100));
+		CHECK(transform.get_origin().y == doctest::Approx(single_transform.get_origin().y).epsilon(0.001));
+		CHECK(velocity.y == doctest::Approx(single_velocity.y).epsilon(0.001));
+	}
+
+	for (const FallingCircle &falling_circle : batched) {
+		physics_server->free_rid(falling_circle.body);
+		physics_server->free_rid(falling_circle.floor);
+	}
+	physics_server->free_rid(single.body);
+	physics_server->free_rid(single.floor);
+	physics_server->free_rid(batched_space);
+	physics_server->free_rid(single_space);
+	physics_server->free_rid(circle_shape);
+	physics_server->free_rid(floor_shape);
+}
+
+} // namespace TestPhysicsServer2D
@@ -69,6 +69,7 @@
 #include "tests/core/math/test_aabb.h"
 #include "tests/core/math/test_astar.h"
 #include "tests/core/math/test_basis.h"
+#include "tests/core/math/test_bvh.h"
 #include "tests/core/math/test_color.h"
 #include "tests/core/math/test_expression.h"
 #include "tests/core/math/test_geometry_2d.h"
@@ -89,6 +90,7 @@
 #include "tests/core/math/test_vector4.h"
 #include "tests/core/math/test_vector4i.h"
 #include "tests/core/object/test_class_db.h"
+#include "tests/core/object/test_message_queue.h"
 #include "tests/core/object/test_method_bind.h"
 #include "tests/core/object/test_object.h"
 #include "tests/core/object/test_undo_redo.h"
@@ -142,6 +144,7 @@
 #include "tests/scene/test_parallax_2d.h"
 #include "tests/scene/test_path_2d.h"
 #include "tests/scene/test_path_follow_2d.h"
+#include "tests/scene/test_scene_pool.h"
 #include "tests/scene/test_sprite_frames.h"
 #include "tests/scene/test_style_box_texture.h"
 #include "tests/scene/test_texture_progress_bar.h"
@@ -169,6 +172,7 @@
 
 #ifndef _3D_DISABLED
 #include "tests/core/math/test_triangle_mesh.h"
+#include "tests/scene/test_animation_mixer.h"
 #include "tests/scene/test_arraymesh.h"
 #include "tests/scene/test_camera_3d.h"
 #include "tests/scene/test_gltf_document.h"
@@ -184,6 +188,10 @@
 #include "tests/scene/test_physics_material.h"
 #endif // PHYSICS_3D_DISABLED
 
+#if !defined(PHYSICS_2D_DISABLED) && defined(MODULE_GODOT_PHYSICS_2D_ENABLED)
+#include "tests/servers/test_physics_server_2d.h"
+#endif // !defined(PHYSICS_2D_DISABLED) && defined(MODULE_GODOT_PHYSICS_2D_ENABLED)
+
 #ifdef MODULE_NAVIGATION_2D_ENABLED
 #include "tests/scene/test_navigation_agent_2d.h"
 #include "tests/scene/test_navigation_obstacle_2d.h"